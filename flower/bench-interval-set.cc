@@ -0,0 +1,54 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "interval-set.hh"
+
+#include "microbench.hh"
+
+/* Overlapping intervals of varying length, like the extents of the
+   grobs in a staff. */
+static vector<Interval>
+make_intervals (vsize count)
+{
+  vector<Interval> ivs;
+  unsigned seed = 1;
+  for (vsize i = 0; i < count; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      Real start = (seed >> 8) % 1000 / 10.0;
+      ivs.push_back (Interval (start, start + (seed >> 4) % 50 / 10.0));
+    }
+  return ivs;
+}
+
+BENCHMARK (interval_set_union_100)
+{
+  vector<Interval> ivs = make_intervals (100);
+  for (vsize i = 0; i < iterations; i++)
+    microbench::keep (Interval_set::interval_union (ivs));
+}
+
+BENCHMARK (interval_set_nearest_point)
+{
+  Interval_set set = Interval_set::interval_union (make_intervals (100)).complement ();
+  Real sum = 0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += set.nearest_point ((i % 1000) / 10.0, (i % 3) ? UP : DOWN);
+  microbench::keep (sum);
+}
@@ -0,0 +1,67 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "polynomial.hh"
+
+#include "microbench.hh"
+
+/* The cubic in t for one coordinate of a slur-like Bezier curve, shifted
+   so that it has three real roots in [0, 1]. */
+static Polynomial
+slur_cubic (Real shift)
+{
+  Polynomial p;
+  p.coefs_.push_back (-0.1 - shift);
+  p.coefs_.push_back (1.9);
+  p.coefs_.push_back (-5.4);
+  p.coefs_.push_back (3.6);
+  return p;
+}
+
+BENCHMARK (polynomial_solve_cubic)
+{
+  Real sum = 0;
+  for (vsize i = 0; i < iterations; i++)
+    {
+      vector<Real> roots = slur_cubic ((i % 100) / 1000.0).solve ();
+      sum += roots.size ();
+    }
+  microbench::keep (sum);
+}
+
+BENCHMARK (polynomial_solve_quadric)
+{
+  Real sum = 0;
+  for (vsize i = 0; i < iterations; i++)
+    {
+      Polynomial p = slur_cubic ((i % 100) / 1000.0);
+      p.differentiate ();
+      sum += p.solve ().size ();
+    }
+  microbench::keep (sum);
+}
+
+BENCHMARK (polynomial_eval)
+{
+  Polynomial p = slur_cubic (0);
+  Real sum = 0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += p.eval ((i % 1000) / 1000.0);
+  microbench::keep (sum);
+}
@@ -0,0 +1,69 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "rational.hh"
+
+#define MICROBENCH_MAIN
+#include "microbench.hh"
+
+/* Durations as they occur in music: mostly powers of two, with the
+   occasional triplet or quintuplet. */
+static Rational const durations[] =
+{
+  Rational (1, 4), Rational (1, 8), Rational (1, 8), Rational (1, 16),
+  Rational (1, 12), Rational (1, 12), Rational (1, 12), Rational (1, 2),
+  Rational (1, 4), Rational (3, 8), Rational (1, 20), Rational (1, 1),
+};
+static const vsize duration_count = sizeof (durations) / sizeof (*durations);
+
+BENCHMARK (rational_add_power_of_two)
+{
+  Rational sum;
+  for (vsize i = 0; i < iterations; i++)
+    sum += durations[i % 4];
+  microbench::keep (sum);
+}
+
+BENCHMARK (rational_add_mixed)
+{
+  Rational sum;
+  for (vsize i = 0; i < iterations; i++)
+    sum += durations[i % duration_count];
+  microbench::keep (sum);
+}
+
+BENCHMARK (rational_multiply)
+{
+  Rational prod (1);
+  for (vsize i = 0; i < iterations; i++)
+    {
+      prod *= durations[i % duration_count];
+      if (prod < Rational (1, 1 << 20))
+        prod = Rational (1);
+    }
+  microbench::keep (prod);
+}
+
+BENCHMARK (rational_compare)
+{
+  int count = 0;
+  for (vsize i = 0; i < iterations; i++)
+    count += durations[i % duration_count] < durations[(i + 5) % duration_count];
+  microbench::keep (count);
+}
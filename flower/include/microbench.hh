@@ -0,0 +1,147 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MICROBENCH_HH
+#define MICROBENCH_HH
+
+#include <cstdio>
+#include <cstring>
+
+#include "cpu-timer.hh"
+#include "std-vector.hh"
+
+/*
+  A minimal microbenchmark harness, used like yaffut.hh:
+
+    BENCHMARK (rational_add)
+    {
+      Rational r;
+      for (vsize i = 0; i < iterations; i++)
+        r += Rational (1, 3);
+      microbench::keep (r);
+    }
+
+  The runner calls every body with a growing ITERATIONS until one call
+  takes at least MIN_SECONDS of CPU time, and prints the time per
+  iteration.  Command line arguments select the benchmarks whose name
+  contains one of them.  One file per executable defines
+  MICROBENCH_MAIN before including this header.
+*/
+
+namespace microbench
+{
+typedef void (*Function) (vsize iterations);
+
+struct Benchmark
+{
+  char const *name_;
+  Function function_;
+};
+
+inline vector<Benchmark> &
+registry ()
+{
+  static vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+struct Registrar
+{
+  Registrar (char const *name, Function function)
+  {
+    Benchmark b;
+    b.name_ = name;
+    b.function_ = function;
+    registry ().push_back (b);
+  }
+};
+
+static volatile char keep_sink;
+
+/* Keep the optimizer from discarding a result that is never used. */
+template<class T>
+inline void
+keep (T const &t)
+{
+  keep_sink = *reinterpret_cast<char const volatile *> (&t);
+}
+
+const Real MIN_SECONDS = 0.2;
+
+inline bool
+selected (char const *name, int argc, char **argv)
+{
+  if (argc < 2)
+    return true;
+  for (int i = 1; i < argc; i++)
+    if (strstr (name, argv[i]))
+      return true;
+  return false;
+}
+
+inline int
+run (int argc, char **argv)
+{
+  vector<Benchmark> const &benchmarks = registry ();
+  for (vsize i = 0; i < benchmarks.size (); i++)
+    {
+      if (!selected (benchmarks[i].name_, argc, argv))
+        continue;
+
+      vsize iterations = 1;
+      Real seconds = 0;
+      for (;;)
+        {
+          Cpu_timer timer;
+          benchmarks[i].function_ (iterations);
+          seconds = timer.read ();
+          if (seconds >= MIN_SECONDS || iterations > (vsize (1) << 40))
+            break;
+
+          /* aim a little past MIN_SECONDS, but never grow more than
+             tenfold, since the first timings are the least precise */
+          vsize next = seconds > 0
+                       ? vsize (iterations * 1.2 * MIN_SECONDS / seconds)
+                       : 10 * iterations;
+          iterations = min (max (next, 2 * iterations), 10 * iterations);
+        }
+
+      printf ("%-40s %12.1f ns/op %14lu iterations\n",
+              benchmarks[i].name_, 1e9 * seconds / iterations,
+              (unsigned long) iterations);
+    }
+  return 0;
+}
+}
+
+#define BENCHMARK(name)                                                 \
+  static void microbench_ ## name (vsize iterations);                   \
+  static microbench::Registrar microbench_registrar_ ## name            \
+    (#name, microbench_ ## name);                                       \
+  static void microbench_ ## name (vsize iterations)
+
+#ifdef MICROBENCH_MAIN
+int
+main (int argc, char **argv)
+{
+  return microbench::run (argc, argv);
+}
+#endif
+
+#endif /* MICROBENCH_HH */
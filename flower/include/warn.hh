@@ -21,6 +21,7 @@
 #define WARN_HH
 
 #include "std-string.hh"
+#include "std-vector.hh"
 
 /* Log-level bitmasks */
 #define LOG_NONE 0
@@ -65,4 +66,21 @@ void set_loglevel (string level);
 void expect_warning (const string &msg);
 void check_expected_warnings ();
 
+/* A programming error, non-fatal error or warning held back by
+   hold_messages ().  */
+struct Held_message
+{
+  enum Kind { PROGRAMMING_ERROR, NON_FATAL_ERROR, WARNING };
+  Kind kind_;
+  string message_;
+  string location_;
+};
+
+/* While HELD is set, the messages above are added to it instead of
+   being reported; pass 0 to report them again.  Processes forked for
+   part of a job hand their messages to the parent, which reports them
+   with report_held_messages ().  */
+void hold_messages (vector<Held_message> *held);
+void report_held_messages (vector<Held_message> const &held);
+
 #endif /* WARN_HH */
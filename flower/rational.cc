@@ -177,6 +177,12 @@ b3:
   return result;
 }
 
+static inline bool
+is_power_of_two (U64 n)
+{
+  return !(n & (n - 1));
+}
+
 void
 Rational::normalize ()
 {
@@ -195,6 +201,17 @@ Rational::normalize ()
       sign_ = 0;
       den_ = 1;
     }
+  else if (den_ == 1)
+    ;
+  else if (is_power_of_two (den_))
+    {
+      /* the only common factors are twos */
+      while (!((num_ | den_) & 1))
+        {
+          num_ >>= 1;
+          den_ >>= 1;
+        }
+    }
   else
     {
       I64 g = gcd (num_, den_);
@@ -209,6 +226,10 @@ Rational::sign () const
   return ::sign (sign_);
 }
 
+/* Numerators and denominators below this can be cross-multiplied
+   without overflowing. */
+static const U64 MAX_CROSS_FACTOR = U64 (1) << 32;
+
 int
 Rational::compare (Rational const &r, Rational const &s)
 {
@@ -220,6 +241,16 @@ Rational::compare (Rational const &r, Rational const &s)
     return 0;
   else if (r.sign_ == 0) // here s.sign_ is also zero
     return 0;
+  else if (r.den_ == s.den_)
+    return r.num_ == s.num_ ? 0 : (r.num_ < s.num_ ? -r.sign_ : r.sign_);
+  else if (r.num_ < MAX_CROSS_FACTOR && r.den_ < MAX_CROSS_FACTOR
+           && s.num_ < MAX_CROSS_FACTOR && s.den_ < MAX_CROSS_FACTOR)
+    {
+      /* same sign and small enough that the products cannot overflow */
+      U64 a = r.num_ * s.den_;
+      U64 b = s.num_ * r.den_;
+      return a == b ? 0 : (a < b ? -r.sign_ : r.sign_);
+    }
   return ::sign (r - s);
 }
 
@@ -243,6 +274,27 @@ Rational::operator += (Rational r)
     ;
   else if (r.is_infinity ())
     *this = r;
+  else if (!r.sign_)
+    ;
+  else if (!sign_)
+    *this = r;
+  else if (den_ == r.den_)
+    {
+      /* common for durations; no lcm needed */
+      I64 n = sign_ * I64 (num_) + r.sign_ * I64 (r.num_);
+      sign_ = ::sign (n);
+      num_ = ::abs (n);
+      normalize ();
+    }
+  else if (is_power_of_two (den_) && is_power_of_two (r.den_))
+    {
+      U64 lcm = max (den_, r.den_);
+      I64 n = sign_ * I64 (num_ * (lcm / den_)) + r.sign_ * I64 (r.num_ * (lcm / r.den_));
+      sign_ = ::sign (n);
+      num_ = ::abs (n);
+      den_ = lcm;
+      normalize ();
+    }
   else
     {
       I64 lcm = (den_ / gcd (r.den_, den_)) * r.den_;
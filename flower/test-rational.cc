@@ -0,0 +1,74 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "rational.hh"
+
+#include "yaffut.hh"
+
+using namespace std;
+
+FUNC (rational_add_same_denominator)
+{
+  EQUAL ((Rational (1, 4) + Rational (1, 4)).to_string (), "1/2");
+  EQUAL ((Rational (1, 3) + Rational (2, 3)).to_string (), "1");
+  EQUAL ((Rational (1, 8) - Rational (1, 8)).to_string (), "0");
+  EQUAL ((Rational (1, 8) - Rational (3, 8)).to_string (), "-1/4");
+}
+
+FUNC (rational_add_power_of_two)
+{
+  EQUAL ((Rational (1, 4) + Rational (3, 16)).to_string (), "7/16");
+  EQUAL ((Rational (-1, 2) + Rational (1, 32)).to_string (), "-15/32");
+  EQUAL ((Rational (3, 4) + Rational (1, 4)).to_string (), "1");
+}
+
+FUNC (rational_add_mixed)
+{
+  EQUAL ((Rational (1, 4) + Rational (1, 12)).to_string (), "1/3");
+  EQUAL ((Rational (1, 6) + Rational (-1, 10)).to_string (), "1/15");
+  EQUAL ((Rational (5) + Rational (0)).to_string (), "5");
+  EQUAL ((Rational (0) + Rational (-2, 3)).to_string (), "-2/3");
+}
+
+FUNC (rational_multiply)
+{
+  EQUAL ((Rational (3, 8) * Rational (2, 3)).to_string (), "1/4");
+  EQUAL ((Rational (1, 4) * Rational (1, 8)).to_string (), "1/32");
+  EQUAL ((Rational (6, 8)).to_string (), "3/4");
+}
+
+FUNC (rational_compare)
+{
+  CHECK (Rational (1, 4) < Rational (3, 4));
+  CHECK (Rational (-3, 4) < Rational (-1, 4));
+  CHECK (Rational (1, 3) > Rational (1, 4));
+  CHECK (Rational (-1, 3) < Rational (-1, 4));
+  CHECK (Rational (2, 6) == Rational (1, 3));
+  CHECK (Rational (-1, 8) < Rational (0));
+  CHECK (Rational (1, 1000000007) < Rational (1, 1000000006));
+
+  Rational inf;
+  inf.set_infinite (1);
+  CHECK (Rational (1000000) < inf);
+  CHECK (-inf < Rational (-1000000));
+
+  /* too big to cross-multiply */
+  Rational big (I64 (1) << 40, 3);
+  CHECK (big < big + Rational (1, 5));
+}
@@ -139,6 +139,46 @@ bool is_expected (const string &s)
   return expected;
 }
 
+static vector<Held_message> *held_messages = 0;
+
+void
+hold_messages (vector<Held_message> *held)
+{
+  held_messages = held;
+}
+
+/* Store a message if messages are held.  */
+static bool
+hold_message (Held_message::Kind kind, const string &s, const string &location)
+{
+  if (!held_messages)
+    return false;
+  Held_message m;
+  m.kind_ = kind;
+  m.message_ = s;
+  m.location_ = location;
+  held_messages->push_back (m);
+  return true;
+}
+
+void
+report_held_messages (vector<Held_message> const &held)
+{
+  for (vsize i = 0; i < held.size (); i++)
+    switch (held[i].kind_)
+      {
+      case Held_message::PROGRAMMING_ERROR:
+        programming_error (held[i].message_, held[i].location_);
+        break;
+      case Held_message::NON_FATAL_ERROR:
+        non_fatal_error (held[i].message_, held[i].location_);
+        break;
+      case Held_message::WARNING:
+        warning (held[i].message_, held[i].location_);
+        break;
+      }
+}
+
 /**
  * Helper functions: print_message_part (no newline prepended)
  *                   print_message (always starts on a new line)
@@ -188,6 +228,8 @@ error (string s, const string &location)
 void
 programming_error (const string &s, const string &location)
 {
+  if (hold_message (Held_message::PROGRAMMING_ERROR, s, location))
+    return;
   if (is_expected (s))
     print_message (LOG_DEBUG, location, _f ("suppressed programming error: %s", s) + "\n");
   else if (warning_as_error)
@@ -203,6 +245,8 @@ programming_error (const string &s, const string &location)
 void
 non_fatal_error (const string &s, const string &location)
 {
+  if (hold_message (Held_message::NON_FATAL_ERROR, s, location))
+    return;
   if (is_expected (s))
     print_message (LOG_DEBUG, location, _f ("suppressed error: %s", s) + "\n");
   else if (warning_as_error)
@@ -215,6 +259,8 @@ non_fatal_error (const string &s, const string &location)
 void
 warning (const string &s, const string &location)
 {
+  if (hold_message (Held_message::WARNING, s, location))
+    return;
   if (is_expected (s))
     print_message (LOG_DEBUG, location, _f ("suppressed warning: %s", s) + "\n");
   else if (warning_as_error)
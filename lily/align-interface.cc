@@ -154,6 +154,8 @@ Align_interface::get_minimum_translations_without_min_dist (Grob *me,
   return internal_get_minimum_translations (me, all_grobs, a, false, false, 0, 0);
 }
 
+static Pure_cache::Counter minimum_translations_counter ("minimum-translations");
+
 // If include_fixed_spacing is false, the only constraints that will be measured
 // here are those that result from collisions (+ padding) and the spacing spec
 // between adjacent staves.
@@ -173,13 +175,14 @@ Align_interface::internal_get_minimum_translations (Grob *me,
   if (!pure && a == Y_AXIS && dynamic_cast<Spanner *> (me) && !me->get_system ())
     me->programming_error ("vertical alignment called before line-breaking");
 
-  // check the cache
+  // check the cache.  During page breaking, every staff asks for its
+  // translation for every candidate line, so most calls end here.
+  SCM cache_symbol = ly_symbol2scm ("minimum-translations");
   if (pure)
     {
-      SCM fv = ly_assoc_get (scm_cons (scm_from_int (start), scm_from_int (end)),
-                             me->get_property ("minimum-translations-alist"),
-                             SCM_EOL);
-      if (!scm_is_null (fv))
+      SCM fv = me->get_cached_pure_property (cache_symbol, start, end,
+                                             &minimum_translations_counter);
+      if (!SCM_UNBNDP (fv))
         return ly_scm2floatvector (fv);
     }
 
@@ -279,13 +282,8 @@ Align_interface::internal_get_minimum_translations (Grob *me,
     }
 
   if (pure)
-    {
-      SCM mta = me->get_property ("minimum-translations-alist");
-      mta = scm_cons (scm_cons (scm_cons (scm_from_int (start), scm_from_int (end)),
-                                ly_floatvector2scm (translates)),
-                      mta);
-      me->set_property ("minimum-translations-alist", mta);
-    }
+    me->cache_pure_property (cache_symbol, start, end,
+                             ly_floatvector2scm (translates));
   return translates;
 }
 
@@ -375,7 +373,6 @@ ADD_INTERFACE (Align_interface,
                "align-dir "
                "axes "
                "elements "
-               "minimum-translations-alist "
                "padding "
                "positioning-done "
                "stacking-dir "
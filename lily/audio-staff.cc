@@ -20,7 +20,6 @@
 #include "audio-staff.hh"
 
 #include "midi-chunk.hh"
-#include "midi-stream.hh"
 #include "midi-walker.hh"
 
 void
@@ -35,7 +34,7 @@ Audio_staff::Audio_staff ()
 }
 
 void
-Audio_staff::output (Midi_stream &midi_stream, int track, bool port, int start_tick)
+Audio_staff::output (string *out, int track, bool port, int start_tick)
 {
   Midi_track midi_track (track, port);
 
@@ -45,6 +44,6 @@ Audio_staff::output (Midi_stream &midi_stream, int track, bool port, int start_t
 
   i.finalize ();
 
-  midi_stream.write (midi_track);
+  midi_track.write (out);
 }
 
@@ -27,6 +27,7 @@
 #include "hara-kiri-group-spanner.hh"
 #include "international.hh"
 #include "interval-set.hh"
+#include "interval-union-tree.hh"
 #include "lookup.hh"
 #include "paper-column.hh"
 #include "paper-score.hh"
@@ -146,6 +147,8 @@ Axis_group_interface::sum_partial_pure_heights (Grob *me, int start, int end)
   return iv;
 }
 
+static Pure_cache::Counter line_pure_height_counter ("line-pure-height");
+
 Interval
 Axis_group_interface::part_of_line_pure_height (Grob *me, bool begin, int start, int end)
 {
@@ -155,22 +158,22 @@ Axis_group_interface::part_of_line_pure_height (Grob *me, bool begin, int start,
   SCM cache_symbol = begin
                      ? ly_symbol2scm ("begin-of-line-pure-height")
                      : ly_symbol2scm ("rest-of-line-pure-height");
-  SCM cached = sp->get_cached_pure_property (cache_symbol, start, end);
+  SCM cached = sp->get_cached_pure_property (cache_symbol, start, end,
+                                             &line_pure_height_counter);
   if (scm_is_pair (cached))
     return robust_scm2interval (cached, Interval (0, 0));
 
-  SCM adjacent_pure_heights = me->get_property ("adjacent-pure-heights");
+  SCM trees = me->get_property ("adjacent-pure-height-trees");
   Interval ret;
 
-  if (!scm_is_pair (adjacent_pure_heights))
+  if (!scm_is_pair (trees))
     ret = Interval (0, 0);
   else
     {
-      SCM these_pure_heights = begin
-                               ? scm_car (adjacent_pure_heights)
-                               : scm_cdr (adjacent_pure_heights);
+      Interval_union_tree *these_pure_heights
+        = unsmob<Interval_union_tree> (begin ? scm_car (trees) : scm_cdr (trees));
 
-      if (scm_is_vector (these_pure_heights))
+      if (these_pure_heights)
         ret = combine_pure_heights (me, these_pure_heights, start, end);
       else
         ret = Interval (0, 0);
@@ -192,25 +195,52 @@ Axis_group_interface::rest_of_line_pure_height (Grob *me, int start, int end)
   return part_of_line_pure_height (me, false, start, end);
 }
 
+/*
+  Measure i runs from the breakpoint with rank ranks[i] to the next
+  one.  We want the measures whose first breakpoint lies in
+  [start, end).
+*/
 Interval
-Axis_group_interface::combine_pure_heights (Grob *me, SCM measure_extents, int start, int end)
+Axis_group_interface::combine_pure_heights (Grob *me, Interval_union_tree const *measure_extents,
+                                            int start, int end)
 {
   Paper_score *ps = get_root_system (me)->paper_score ();
-  vector<vsize> breaks = ps->get_break_indices ();
-  vector<Grob *> cols = ps->get_columns ();
+  vector<vsize> const &ranks = ps->get_break_ranks ();
+  if (ranks.size () < 2 || end <= 0)
+    return Interval ();
 
-  Interval ext;
-  for (vsize i = 0; i + 1 < breaks.size (); i++)
-    {
-      int r = Paper_column::get_rank (cols[breaks[i]]);
-      if (r >= end)
-        break;
+  vsize from = lower_bound (ranks, vsize (max (start, 0)), less<vsize> ());
+  vsize to = lower_bound (ranks, vsize (end), less<vsize> ());
+  to = min (to, min (ranks.size () - 1, measure_extents->size ()));
+  if (from >= to)
+    return Interval ();
 
-      if (r >= start)
-        ext.unite (ly_scm2interval (scm_c_vector_ref (measure_extents, i)));
-    }
+  return measure_extents->union_of (from, to);
+}
+
+static SCM
+make_pure_height_tree (SCM measure_extents)
+{
+  if (!scm_is_vector (measure_extents))
+    return SCM_BOOL_F;
+
+  vector<Interval> extents;
+  for (size_t i = 0; i < scm_c_vector_length (measure_extents); i++)
+    extents.push_back (ly_scm2interval (scm_c_vector_ref (measure_extents, i)));
+  return Interval_union_tree (extents).smobbed_copy ();
+}
+
+MAKE_SCHEME_CALLBACK (Axis_group_interface, calc_adjacent_pure_height_trees, 1)
+SCM
+Axis_group_interface::calc_adjacent_pure_height_trees (SCM smob)
+{
+  Grob *me = unsmob<Grob> (smob);
+  SCM heights = me->get_property ("adjacent-pure-heights");
+  if (!scm_is_pair (heights))
+    return SCM_EOL;
 
-  return ext;
+  return scm_cons (make_pure_height_tree (scm_car (heights)),
+                   make_pure_height_tree (scm_cdr (heights)));
 }
 
 // adjacent-pure-heights is a pair of vectors, each of which has one element
@@ -1038,6 +1068,7 @@ ADD_INTERFACE (Axis_group_interface,
                // VerticalAxisGroup. We should split off a
                // vertical-axis-group-interface.
                /* properties */
+               "adjacent-pure-height-trees "
                "adjacent-pure-heights "
                "axes "
                "bound-alignment-interfaces "
@@ -168,6 +168,15 @@ LY_DEFINE (ly_beam_score_count, "ly:beam-score-count", 0, 0, 0,
   return scm_from_int (score_count);
 }
 
+// Number of configurations generated for the last beam quanted.
+static int configuration_count = 0;
+LY_DEFINE (ly_beam_configuration_count, "ly:beam-configuration-count", 0, 0, 0,
+           (),
+           "count number of beam configurations generated for the last beam.")
+{
+  return scm_from_int (configuration_count);
+}
+
 void Beam_scoring_problem::add_collision (Real x, Interval y,
                                           Real score_factor)
 {
@@ -404,6 +413,26 @@ Beam_scoring_problem::Beam_scoring_problem (Grob *me, Drul_array<Real> ys, bool
       slope_damping ();
       shift_region_to_valid ();
     }
+
+  /*
+    Read everything solve () needs from the grob here, so that the
+    scoring itself only touches the numbers collected above.
+  */
+  skip_quanting_ = to_boolean (beam_->get_property ("skip-quanting"));
+  debug_ = to_boolean (beam_->layout ()->lookup_variable (ly_symbol2scm ("debug-beam-scoring")));
+
+  SCM inspect_quants = beam_->get_property ("inspect-quants");
+  has_inspect_quants_ = scm_is_pair (inspect_quants);
+  if (has_inspect_quants_)
+    {
+      debug_ = true;
+      inspect_quants_ = ly_scm2interval (inspect_quants);
+    }
+
+  normalized_endpoints_ = Interval (0, 1);
+  if (align_broken_intos_)
+    normalized_endpoints_
+      = robust_scm2interval (beam_->get_property ("normalized-endpoints"), Interval (0, 1));
 }
 
 // Assuming V is not empty, pick a 'reasonable' point inside V.
@@ -853,8 +882,14 @@ Beam_scoring_problem::shift_region_to_valid ()
   unquanted_y_ = Drul_array<Real> (beam_left_y, (beam_left_y + beam_dy));
 }
 
+static bool
+abs_less (Real a, Real b)
+{
+  return fabs (a) < fabs (b);
+}
+
 void
-Beam_scoring_problem::generate_quants (vector<Beam_configuration *> *scores) const
+Beam_scoring_problem::generate_quants (vector<Real> *quants) const
 {
   int region_size = (int) parameters_.REGION_SIZE;
 
@@ -874,35 +909,100 @@ Beam_scoring_problem::generate_quants (vector<Beam_configuration *> *scores) con
   /*
     Asymetry ? should run to <= region_size ?
   */
-  vector<Real> unshifted_quants;
   for (int i = -region_size; i < region_size; i++)
     for (int j = 0; j < num_base_quants; j++)
       {
-        unshifted_quants.push_back (i + base_quants[j]);
+        quants->push_back (i + base_quants[j]);
       }
 
-  for (vsize i = 0; i < unshifted_quants.size (); i++)
-    for (vsize j = 0; j < unshifted_quants.size (); j++)
+  // Beam_quant_generator wants the offsets closest to zero first.
+  stable_sort (quants->begin (), quants->end (), abs_less);
+}
+
+/*
+  Hands out the candidate configurations one at a time, in order of
+  their initial demerits |offset[LEFT]| + |offset[RIGHT]|.  No scorer
+  decreases demerits, so bound () is a lower bound for the final score
+  of every configuration not handed out yet.
+
+  QUANTS must be sorted by absolute value.  For every left offset we
+  keep the next right offset to pair it with, and a queue over the left
+  offsets yields the pair with the smallest sum.
+*/
+class Beam_quant_generator
+{
+  struct Pair
+  {
+    Real bound_;
+    vsize left_;
+    vsize right_;
+
+    bool operator < (Pair const &other) const
+    {
+      // Invert, for a min-queue.
+      if (bound_ != other.bound_)
+        return bound_ > other.bound_;
+      if (left_ != other.left_)
+        return left_ > other.left_;
+      return right_ > other.right_;
+    }
+  };
+
+  vector<Real> const &quants_;
+  Interval start_;
+  Drul_array<Interval> range_;
+  std::priority_queue<Pair> pairs_;
+
+public:
+  Beam_quant_generator (vector<Real> const &quants, Interval start,
+                        Drul_array<Interval> range)
+    : quants_ (quants), start_ (start), range_ (range)
+  {
+    if (quants_.empty ())
+      return;
+    for (vsize i = 0; i < quants_.size (); i++)
       {
-        Beam_configuration *c
-          = Beam_configuration::new_config (unquanted_y_,
-                                            Interval (unshifted_quants[i],
-                                                      unshifted_quants[j]));
+        Pair p = {fabs (quants_[i]) + fabs (quants_[0]), i, 0};
+        pairs_.push (p);
+      }
+  }
+
+  Real bound () const
+  {
+    return pairs_.empty () ? infinity_f : pairs_.top ().bound_ / 1000.0;
+  }
 
+  // Returns NULL when all configurations have been handed out.
+  Beam_configuration *next ()
+  {
+    while (!pairs_.empty ())
+      {
+        Pair p = pairs_.top ();
+        pairs_.pop ();
+        if (p.right_ + 1 < quants_.size ())
+          {
+            Pair q = {fabs (quants_[p.left_]) + fabs (quants_[p.right_ + 1]),
+                      p.left_, p.right_ + 1};
+            pairs_.push (q);
+          }
+
+        Beam_configuration *c
+          = Beam_configuration::new_config (start_,
+                                            Interval (quants_[p.left_],
+                                                      quants_[p.right_]));
+        bool in_range = true;
         for (LEFT_and_RIGHT (d))
+          in_range = in_range && range_[d].contains (c->y[d]);
+        if (in_range)
           {
-            if (!quant_range_[d].contains (c->y[d]))
-              {
-                delete c;
-                c = NULL;
-                break;
-              }
+            configuration_count++;
+            return c;
           }
-        if (c)
-          scores->push_back (c);
+        delete c;
       }
-
-}
+    return NULL;
+  }
+};
 
 void Beam_scoring_problem::one_scorer (Beam_configuration *config) const
 {
@@ -940,14 +1040,14 @@ void Beam_scoring_problem::one_scorer (Beam_configuration *config) const
 }
 
 Beam_configuration *
-Beam_scoring_problem::force_score (SCM inspect_quants, const vector<Beam_configuration *> &configs) const
+Beam_scoring_problem::force_score (const vector<Beam_configuration *> &configs) const
 {
-  Drul_array<Real> ins = ly_scm2interval (inspect_quants);
   Real mindist = 1e6;
   Beam_configuration *best = NULL;
   for (vsize i = 0; i < configs.size (); i++)
     {
-      Real d = fabs (configs[i]->y[LEFT] - ins[LEFT]) + fabs (configs[i]->y[RIGHT] - ins[RIGHT]);
+      Real d = fabs (configs[i]->y[LEFT] - inspect_quants_[LEFT])
+               + fabs (configs[i]->y[RIGHT] - inspect_quants_[RIGHT]);
       if (d < mindist)
         {
           best = configs[i];
@@ -963,11 +1063,23 @@ Beam_scoring_problem::force_score (SCM inspect_quants, const vector<Beam_configu
   return best;
 }
 
+/*
+  Find the best quanting.  This does not look at the beam grob; all
+  input has been collected by the constructor.  If debugging is
+  switched on, a score card is stored in *CARD, to be set as
+  annotation by the caller.
+*/
 Drul_array<Real>
-Beam_scoring_problem::solve () const
+Beam_scoring_problem::solve (string *card) const
 {
+  vector<Real> quants;
+  generate_quants (&quants);
+  Beam_quant_generator generator (quants, unquanted_y_, quant_range_);
+
+  configuration_count = 0;
   vector<Beam_configuration *> configs;
-  generate_quants (&configs);
+  if (Beam_configuration *first = generator.next ())
+    configs.push_back (first);
 
   if (configs.empty ())
     {
@@ -975,25 +1087,25 @@ Beam_scoring_problem::solve () const
       return unquanted_y_;
     }
 
-  if (to_boolean (beam_->get_property ("skip-quanting")))
-    return unquanted_y_;
+  if (skip_quanting_)
+    {
+      junk_pointers (configs);
+      return unquanted_y_;
+    }
 
   Beam_configuration *best = NULL;
 
-  bool debug
-    = to_boolean (beam_->layout ()->lookup_variable (ly_symbol2scm ("debug-beam-scoring")));
-  SCM inspect_quants = beam_->get_property ("inspect-quants");
-  if (scm_is_pair (inspect_quants))
+  if (has_inspect_quants_)
     {
-      debug = true;
-      best = force_score (inspect_quants, configs);
+      while (Beam_configuration *c = generator.next ())
+        configs.push_back (c);
+      best = force_score (configs);
     }
   else
     {
       std::priority_queue < Beam_configuration *, std::vector<Beam_configuration *>,
           Beam_configuration_less > queue;
-      for (vsize i = 0; i < configs.size (); i++)
-        queue.push (configs[i]);
+      queue.push (configs[0]);
 
       /*
         TODO
@@ -1010,9 +1122,23 @@ Beam_scoring_problem::solve () const
         }
 
         that would allow us to do away with region_size altogether.
+
+        Configurations are now generated on the fly, but still only
+        within region_size.
       */
       while (true)
         {
+          /* Only generate configurations that might still beat the
+             best one in the queue. */
+          while (generator.bound () < queue.top ()->demerits)
+            {
+              Beam_configuration *c = generator.next ();
+              if (!c)
+                break;
+              configs.push_back (c);
+              queue.push (c);
+            }
+
           best = queue.top ();
           if (best->done ())
             break;
@@ -1026,7 +1152,7 @@ Beam_scoring_problem::solve () const
   Interval final_positions = best->y;
 
 #if DEBUG_BEAM_SCORING
-  if (debug)
+  if (debug_ && card)
     {
       // debug quanting
       int completed = 0;
@@ -1036,19 +1162,17 @@ Beam_scoring_problem::solve () const
             completed++;
         }
 
-      string card = best->score_card_ + to_string (" c%d/%d", completed, configs.size ());
-      beam_->set_property ("annotation", ly_string2scm (card));
+      *card = best->score_card_ + to_string (" c%d/%d", completed, configs.size ());
     }
 #endif
 
   junk_pointers (configs);
   if (align_broken_intos_)
     {
-      Interval normalized_endpoints = robust_scm2interval (beam_->get_property ("normalized-endpoints"), Interval (0, 1));
       Real y_length = final_positions[RIGHT] - final_positions[LEFT];
 
-      final_positions[LEFT] += normalized_endpoints[LEFT] * y_length;
-      final_positions[RIGHT] -= (1 - normalized_endpoints[RIGHT]) * y_length;
+      final_positions[LEFT] += normalized_endpoints_[LEFT] * y_length;
+      final_positions[RIGHT] -= (1 - normalized_endpoints_[RIGHT]) * y_length;
     }
 
   return final_positions;
@@ -990,7 +990,13 @@ Beam::quanting (SCM smob, SCM ys_scm, SCM align_broken_intos)
   bool cbs = to_boolean (align_broken_intos);
 
   Beam_scoring_problem problem (me, ys, cbs);
-  ys = problem.solve ();
+  string card;
+  ys = problem.solve (&card);
+
+#if DEBUG_BEAM_SCORING
+  if (!card.empty ())
+    me->set_property ("annotation", ly_string2scm (card));
+#endif
 
   return ly_interval2scm (ys);
 }
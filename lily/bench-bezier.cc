@@ -0,0 +1,76 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bezier.hh"
+
+#include "microbench.hh"
+
+/* A slur over a few notes. */
+static Bezier
+make_slur ()
+{
+  Bezier curve;
+  curve.control_[0] = Offset (0, 0);
+  curve.control_[1] = Offset (2, 2.5);
+  curve.control_[2] = Offset (8, 2.5);
+  curve.control_[3] = Offset (10, 0.5);
+  return curve;
+}
+
+BENCHMARK (bezier_curve_point)
+{
+  Bezier curve = make_slur ();
+  Real sum = 0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += curve.curve_point ((i % 1000) / 1000.0)[Y_AXIS];
+  microbench::keep (sum);
+}
+
+BENCHMARK (bezier_get_other_coordinate)
+{
+  Bezier curve = make_slur ();
+  Real sum = 0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += curve.get_other_coordinate (X_AXIS, (i % 100) / 10.0);
+  microbench::keep (sum);
+}
+
+BENCHMARK (bezier_get_other_coordinate_batch_16)
+{
+  Bezier curve = make_slur ();
+  vector<Real> xs;
+  for (vsize i = 0; i < 16; i++)
+    xs.push_back (0.3 + i * 0.6);
+  vector<Real> ys;
+  for (vsize i = 0; i < iterations; i++)
+    {
+      curve.get_other_coordinate (X_AXIS, xs, &ys);
+      microbench::keep (ys);
+    }
+}
+
+BENCHMARK (bezier_extent)
+{
+  Bezier curve = make_slur ();
+  for (vsize i = 0; i < iterations; i++)
+    {
+      curve.control_[1][Y_AXIS] = 2 + (i % 10) * 0.1;
+      microbench::keep (curve.extent (Y_AXIS));
+    }
+}
@@ -0,0 +1,39 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "keyword.hh"
+
+#include "lily-lexer.hh"
+#include "microbench.hh"
+
+/* what the lexer sees after a backslash: mostly identifiers */
+static char const *words[] =
+{
+  "p", "relative", "new", "staccato", "override", "time", "f", "set",
+  "bar", "key", "score", "clef", "tuplet", "markup", "fermata", "mf",
+};
+
+BENCHMARK (keyword_lookup)
+{
+  Keyword_table table (the_key_tab);
+  vsize found = 0;
+  for (vsize i = 0; i < iterations; i++)
+    found += table.lookup (words[i % 16]) != VPOS;
+  microbench::keep (found);
+}
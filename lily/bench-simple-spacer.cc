@@ -0,0 +1,67 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "simple-spacer.hh"
+
+#include "microbench.hh"
+
+/* The springs of a line of music, with some rods between neighbouring
+   columns. */
+static Simple_spacer
+make_spacer (vsize columns)
+{
+  Simple_spacer spacer;
+  for (vsize i = 0; i < columns; i++)
+    {
+      Spring spring (1.0 + (i % 3) * 0.5, 0.8);
+      spring.set_default_strength ();
+      spacer.add_spring (spring);
+    }
+  for (vsize i = 0; i + 2 < columns; i += 5)
+    spacer.add_rod (int (i), int (i + 2), 3.5);
+  return spacer;
+}
+
+BENCHMARK (simple_spacer_stretch_60)
+{
+  Simple_spacer spacer = make_spacer (60);
+  for (vsize i = 0; i < iterations; i++)
+    {
+      spacer.solve (120.0 + (i % 10), false);
+      microbench::keep (spacer.force ());
+    }
+}
+
+BENCHMARK (simple_spacer_compress_60)
+{
+  Simple_spacer spacer = make_spacer (60);
+  for (vsize i = 0; i < iterations; i++)
+    {
+      spacer.solve (70.0 + (i % 10), false);
+      microbench::keep (spacer.force ());
+    }
+}
+
+BENCHMARK (simple_spacer_positions_60)
+{
+  Simple_spacer spacer = make_spacer (60);
+  spacer.solve (120.0, false);
+  for (vsize i = 0; i < iterations; i++)
+    microbench::keep (spacer.spring_positions ());
+}
@@ -0,0 +1,69 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "skyline.hh"
+
+#define MICROBENCH_MAIN
+#include "microbench.hh"
+
+/* Boxes like the note heads, stems and accidentals of a staff: short
+   and overlapping, spread along the X axis. */
+static vector<Box>
+make_boxes (vsize count, Real height)
+{
+  vector<Box> boxes;
+  unsigned seed = 1;
+  for (vsize i = 0; i < count; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      Real x = i * 1.5 + (seed >> 8) % 10 / 10.0;
+      Real y = height + (seed >> 4) % 80 / 10.0 - 4;
+      boxes.push_back (Box (Interval (x, x + 1.3), Interval (y - 0.5, y + 0.5)));
+    }
+  return boxes;
+}
+
+BENCHMARK (skyline_build_200)
+{
+  vector<Box> boxes = make_boxes (200, 0);
+  for (vsize i = 0; i < iterations; i++)
+    microbench::keep (Skyline (boxes, X_AXIS, UP));
+}
+
+BENCHMARK (skyline_merge_200)
+{
+  Skyline a (make_boxes (200, 0), X_AXIS, UP);
+  Skyline b (make_boxes (200, 3), X_AXIS, UP);
+  for (vsize i = 0; i < iterations; i++)
+    {
+      Skyline c (a);
+      c.merge (b);
+      microbench::keep (c);
+    }
+}
+
+BENCHMARK (skyline_distance_200)
+{
+  Skyline up (make_boxes (200, 0), X_AXIS, UP);
+  Skyline down (make_boxes (200, 10), X_AXIS, DOWN);
+  Real sum = 0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += up.distance (down, (i % 4) * 0.25);
+  microbench::keep (sum);
+}
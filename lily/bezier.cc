@@ -230,6 +230,36 @@ Bezier::solve_point (Axis ax, Real coordinate) const
   return filter_solutions (sol);
 }
 
+/*
+  get_other_coordinate () for all of XS at once, storing the results
+  in YS.  The polynomial for axis A is set up only once, which is
+  where most of the time goes when evaluating a single point.
+*/
+void
+Bezier::get_other_coordinate (Axis a, vector<Real> const &xs,
+                              vector<Real> *ys) const
+{
+  Axis other = other_axis (a);
+  Polynomial poly (polynomial (a));
+
+  ys->resize (xs.size ());
+  for (vsize i = 0; i < xs.size (); i++)
+    {
+      Polynomial p (poly);
+      p.coefs_[0] -= xs[i];
+
+      vector<Real> ts = filter_solutions (p.solve ());
+      if (ts.empty ())
+        {
+          programming_error ("no solution found for Bezier intersection");
+          (*ys)[i] = 0.0;
+          continue;
+        }
+
+      (*ys)[i] = curve_coordinate (ts[0], other);
+    }
+}
+
 /**
    For the portion of the curve between L and R along axis AX,
    return the bounding box limit in direction D along the cross axis to AX.
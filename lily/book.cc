@@ -30,6 +30,7 @@ using namespace std;
 #include "text-interface.hh"
 #include "warn.hh"
 #include "performance.hh"
+#include "program-option.hh"
 #include "paper-score.hh"
 #include "page-marker.hh"
 #include "ly-module.hh"
@@ -253,7 +254,12 @@ Book::process_score (SCM s, Paper_book *output_paper_book, Output_def *layout)
     }
   else if (Text_interface::is_markup_list (scm_car (s))
            || unsmob<Page_marker> (scm_car (s)))
-    output_paper_book->add_score (scm_car (s));
+    {
+      /* With -dmidi-only, a book without scores has no pages, so that
+         neither its titles nor its markups are typeset.  */
+      if (!get_program_option ("midi-only"))
+        output_paper_book->add_score (scm_car (s));
+    }
   else
     assert (0);
 
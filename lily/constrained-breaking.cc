@@ -25,6 +25,7 @@
 #include "page-layout-problem.hh"
 #include "paper-column.hh"
 #include "paper-score.hh"
+#include "program-option.hh"
 #include "simple-spacer.hh"
 #include "system.hh"
 #include "warn.hh"
@@ -166,6 +167,19 @@ Constrained_breaking::resize (vsize systems)
 
 vector<Column_x_positions>
 Constrained_breaking::solve (vsize start, vsize end, vsize sys_count)
+{
+  if (linear_breaking_)
+    {
+      vector<vsize> const &brks = linear_breaks (start, end);
+      if (brks.size () == sys_count + 1)
+        return linear_solution (start, brks);
+    }
+  return table_solve (start, end, sys_count);
+}
+
+/* Like solve (), but always from the table. */
+vector<Column_x_positions>
+Constrained_breaking::table_solve (vsize start, vsize end, vsize sys_count)
 {
   vsize start_brk = starting_breakpoints_[start];
   vsize end_brk = prepare_solution (start, end, sys_count);
@@ -209,8 +223,164 @@ Constrained_breaking::solve (vsize start, vsize end, vsize sys_count)
   return ret;
 }
 
+/* The ranks of the columns that end the lines of SOL. */
+static string
+break_ranks (vector<Column_x_positions> const &sol)
+{
+  string ret;
+  for (vsize i = 0; i < sol.size (); i++)
+    {
+      if (i)
+        ret += " ";
+      ret += sol[i].cols_.empty ()
+             ? string ("?")
+             : to_string (Paper_column::get_rank (sol[i].cols_.back ()));
+    }
+  return ret;
+}
+
 vector<Column_x_positions>
 Constrained_breaking::best_solution (vsize start, vsize end)
+{
+  if (linear_breaking_)
+    {
+      vector<vsize> const &brks = linear_breaks (start, end);
+      if (!brks.empty ())
+        {
+          vector<Column_x_positions> ret = linear_solution (start, brks);
+          if (get_program_option ("check-line-breaking"))
+            {
+              vector<Column_x_positions> table = table_best_solution (start, end);
+              string linear = break_ranks (ret);
+              string optimal = break_ranks (table);
+              if (linear != optimal)
+                warning (_f ("linear line breaking differs from the default: "
+                             "lines end at columns %s instead of %s",
+                             linear.c_str (), optimal.c_str ()));
+            }
+          return ret;
+        }
+    }
+  return table_best_solution (start, end);
+}
+
+bool
+Constrained_breaking::linear_breaking () const
+{
+  return linear_breaking_;
+}
+
+/*
+  A possible last line for the linear breaker: the line from
+  breakpoint start_ to the breakpoint whose list holds this node,
+  with the least demerits of any breaking that ends in that line.
+*/
+struct Linear_break_node
+{
+  vsize start_;
+  vsize prev_; /* index of the previous line among those ending at start_ */
+  Real demerits_;
+};
+
+/*
+  When only the best breaking over all system counts is wanted, the
+  system count can be dropped from the state.  combine_demerits ()
+  couples the force of each line to that of the previous line, so the
+  state is the last line itself: for every line ending at brk we keep
+  the best breaking that ends in that line.  This minimises the same
+  sum of demerits as the table, over all breakings at once.
+
+  initialize () only fills out lines_ up to the first line that is too
+  cramped, so at most w lines end at any breakpoint, and the lines
+  before them are found among the at most w lines ending at their
+  start.  This is O(n * w^2) for n breakpoints instead of the O(n^2 * k)
+  of filling out state_ for every system count.
+
+  Returns the breakpoints, counted from starting_breakpoints_[start],
+  or an empty vector if there is no breaking without overfull lines.
+  The result is cached, so that solve () and line_details () can use
+  it when they are asked for the same number of systems.
+*/
+vector<vsize> const &
+Constrained_breaking::linear_breaks (vsize start, vsize end)
+{
+  if (end >= start_.size ())
+    end = start_.size ();
+
+  pair<vsize, vsize> key (start, end);
+  map<pair<vsize, vsize>, vector<vsize> >::iterator it = linear_breaks_.find (key);
+  if (it != linear_breaks_.end ())
+    return it->second;
+
+  vector<vsize> &ret = linear_breaks_[key];
+  vsize start_brk = starting_breakpoints_[start];
+  vsize end_brk = (end == start_.size ()) ? breaks_.size () - 1 : starting_breakpoints_[end];
+  vsize count = end_brk - start_brk + 1;
+  if (count < 2)
+    return ret;
+
+  vector<vector<Linear_break_node> > ending (count);
+  for (vsize brk = 1; brk < count; brk++)
+    for (vsize j = brk; j-- > 0;)
+      {
+        Line_details const &cur = lines_.at (brk + start_brk, j + start_brk);
+        if (isinf (cur.force_))
+          break;
+
+        Linear_break_node n;
+        n.start_ = j;
+        n.prev_ = VPOS;
+        n.demerits_ = infinity_f;
+        if (j == 0)
+          n.demerits_ = combine_demerits (cur.force_, 0) + cur.break_penalty_;
+
+        vector<Linear_break_node> const &prev = ending[j];
+        for (vsize k = 0; k < prev.size (); k++)
+          {
+            Real prev_f = lines_.at (j + start_brk, prev[k].start_ + start_brk).force_;
+            Real dem = combine_demerits (cur.force_, prev_f) + prev[k].demerits_ + cur.break_penalty_;
+            if (dem < n.demerits_)
+              {
+                n.demerits_ = dem;
+                n.prev_ = k;
+              }
+          }
+        if (!isinf (n.demerits_))
+          ending[brk].push_back (n);
+      }
+
+  vector<Linear_break_node> const &last = ending[count - 1];
+  vsize best = VPOS;
+  for (vsize k = 0; k < last.size (); k++)
+    if (best == VPOS || last[k].demerits_ < last[best].demerits_)
+      best = k;
+  if (best == VPOS)
+    return ret;
+
+  ret.push_back (count - 1);
+  for (vsize brk = count - 1, k = best; brk > 0;)
+    {
+      Linear_break_node const &n = ending[brk][k];
+      brk = n.start_;
+      k = n.prev_;
+      ret.push_back (brk);
+    }
+  reverse (ret);
+  return ret;
+}
+
+vector<Column_x_positions>
+Constrained_breaking::linear_solution (vsize start, vector<vsize> const &brks)
+{
+  vsize start_brk = starting_breakpoints_[start];
+  vector<Column_x_positions> ret;
+  for (vsize i = 1; i < brks.size (); i++)
+    ret.push_back (space_line (brks[i - 1] + start_brk, brks[i] + start_brk));
+  return ret;
+}
+
+vector<Column_x_positions>
+Constrained_breaking::table_best_solution (vsize start, vsize end)
 {
   vsize min_systems = min_system_count (start, end);
   vsize max_systems = max_system_count (start, end);
@@ -225,11 +395,11 @@ Constrained_breaking::best_solution (vsize start, vsize end)
       if (dem < best_demerits)
         {
           best_demerits = dem;
-          best_so_far = solve (start, end, i);
+          best_so_far = table_solve (start, end, i);
         }
       else
         {
-          vector<Column_x_positions> cur = solve (start, end, i);
+          vector<Column_x_positions> cur = table_solve (start, end, i);
           bool too_many_lines = true;
 
           for (vsize j = 0; j < cur.size (); j++)
@@ -244,12 +414,25 @@ Constrained_breaking::best_solution (vsize start, vsize end)
     }
   if (best_so_far.size ())
     return best_so_far;
-  return solve (start, end, max_systems);
+  return table_solve (start, end, max_systems);
 }
 
 std::vector<Line_details>
 Constrained_breaking::line_details (vsize start, vsize end, vsize sys_count)
 {
+  if (linear_breaking_)
+    {
+      vector<vsize> const &brks = linear_breaks (start, end);
+      if (brks.size () == sys_count + 1)
+        {
+          vsize start_brk = starting_breakpoints_[start];
+          vector<Line_details> ret;
+          for (vsize i = 1; i < brks.size (); i++)
+            ret.push_back (lines_.at (brks[i] + start_brk, brks[i - 1] + start_brk));
+          return ret;
+        }
+    }
+
   vsize end_brk = prepare_solution (start, end, sys_count);
   Matrix<Constrained_break_node> const &st = state_[start];
   vector<Line_details> ret;
@@ -349,6 +532,7 @@ Constrained_breaking::prepare_solution (vsize start, vsize end, vsize sys_count)
 Constrained_breaking::Constrained_breaking (Paper_score *ps)
 {
   valid_systems_ = systems_ = 0;
+  linear_breaking_ = false;
   start_.push_back (0);
   pscore_ = ps;
   initialize ();
@@ -358,6 +542,7 @@ Constrained_breaking::Constrained_breaking (Paper_score *ps, vector<vsize> const
   : start_ (start)
 {
   valid_systems_ = systems_ = 0;
+  linear_breaking_ = false;
   pscore_ = ps;
   initialize ();
 }
@@ -382,6 +567,8 @@ Constrained_breaking::initialize ()
 
   ragged_right_ = to_boolean (pscore_->layout ()->c_variable ("ragged-right"));
   ragged_last_ = to_boolean (pscore_->layout ()->c_variable ("ragged-last"));
+  linear_breaking_ = scm_is_eq (pscore_->layout ()->c_variable ("breaking-algorithm"),
+                                ly_symbol2scm ("linear"));
   system_system_space_ = 0;
   system_markup_space_ = 0;
   system_system_padding_ = 0;
@@ -187,23 +187,79 @@ Grob::internal_get_property (SCM sym) const
   return val;
 }
 
-/* Unlike internal_get_property, this function does no caching. Use it, therefore, with caution. */
+static Pure_cache::Counter pure_height_counter ("pure-height");
+static Pure_cache::Counter pure_skylines_counter ("pure-skylines");
+
+/*
+  Only heights and skylines go into the pure cache: they are asked for
+  many times per line during page breaking, and their pure callbacks
+  really do depend on nothing but START and END.
+*/
+static Pure_cache::Counter *
+pure_cache_counter (SCM sym)
+{
+  if (scm_is_eq (sym, ly_symbol2scm ("Y-extent")))
+    return &pure_height_counter;
+  if (scm_is_eq (sym, ly_symbol2scm ("vertical-skylines"))
+      || scm_is_eq (sym, ly_symbol2scm ("horizontal-skylines")))
+    return &pure_skylines_counter;
+  return 0;
+}
+
+/*
+  Unlike internal_get_property, this function only caches the
+  properties picked by pure_cache_counter (), and values that do not
+  depend on START and END.  A value computed while a cyclic pure
+  Y-offset was taken to be 0 is not cached either, since it may be
+  wrong.
+*/
 SCM
 Grob::internal_get_pure_property (SCM sym, int start, int end) const
 {
   SCM val = internal_get_property_data (sym);
-  if (ly_is_procedure (val))
-    return call_pure_function (val, scm_list_1 (self_scm ()), start, end);
+  Unpure_pure_container *upc = unsmob<Unpure_pure_container> (val);
+  if (!upc && !ly_is_procedure (val))
+    return val;
 
-  if (Unpure_pure_container *upc = unsmob<Unpure_pure_container> (val)) {
-    // Do cache, if the function ignores 'start' and 'end'
-    if (upc->is_unchanging ())
-      return internal_get_property (sym);
-    else
-      return call_pure_function (val, scm_list_1 (self_scm ()), start, end);
-  }
+  // Do cache, if the function ignores 'start' and 'end'
+  if (upc && upc->is_unchanging ())
+    return internal_get_property (sym);
 
-  return val;
+  Pure_cache::Counter *counter = pure_cache_counter (sym);
+  if (counter)
+    {
+      SCM cached = get_cached_pure_property (sym, start, end, counter);
+      if (!SCM_UNBNDP (cached))
+        return cached;
+    }
+
+  int cycles = pure_cycle_count_;
+  SCM ret = call_pure_function (val, scm_list_1 (self_scm ()), start, end);
+  if (counter && cycles == pure_cycle_count_)
+    cache_pure_property (sym, start, end, ret);
+  return ret;
+}
+
+/* Return SCM_UNDEFINED if nothing is cached. */
+SCM
+Grob::get_cached_pure_property (SCM sym, int start, int end,
+                                Pure_cache::Counter *counter) const
+{
+  if (!pure_cache_)
+    {
+      counter->miss ();
+      return SCM_UNDEFINED;
+    }
+  return pure_cache_->get (sym, start, end, counter);
+}
+
+void
+Grob::cache_pure_property (SCM sym, int start, int end, SCM val) const
+{
+  Grob *me = (Grob *) this;
+  if (!me->pure_cache_)
+    me->pure_cache_ = new Pure_cache;
+  me->pure_cache_->set (sym, start, end, val);
 }
 
 SCM
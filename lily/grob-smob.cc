@@ -42,6 +42,9 @@ Grob::mark_smob () const
   if (original ())
     scm_gc_mark (original ()->self_scm ());
 
+  if (pure_cache_)
+    pure_cache_->gc_mark ();
+
   derived_mark ();
   scm_gc_mark (object_alist_);
   scm_gc_mark (interfaces_);
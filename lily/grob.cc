@@ -53,6 +53,7 @@ Grob::Grob (SCM basicprops)
   /* FIXME: default should be no callback.  */
   layout_ = 0;
   original_ = 0;
+  pure_cache_ = 0;
   interfaces_ = SCM_EOL;
   immutable_property_alist_ = basicprops;
   mutable_property_alist_ = SCM_EOL;
@@ -96,6 +97,7 @@ Grob::Grob (Grob const &s)
   : Smob<Grob> ()
 {
   original_ = (Grob *) & s;
+  pure_cache_ = 0;
 
   immutable_property_alist_ = s.immutable_property_alist_;
   mutable_property_alist_ = SCM_EOL;
@@ -116,6 +118,7 @@ Grob::Grob (Grob const &s)
 
 Grob::~Grob ()
 {
+  delete pure_cache_;
 }
 /****************************************************************
   STENCILS
@@ -348,6 +351,10 @@ Grob::relative_coordinate (Grob const *refp, Axis a) const
   return off;
 }
 
+static Pure_cache::Counter pure_offset_counter ("pure-offset");
+
+int Grob::pure_cycle_count_ = 0;
+
 Real
 Grob::pure_relative_y_coordinate (Grob const *refp, int start, int end)
 {
@@ -359,23 +366,44 @@ Grob::pure_relative_y_coordinate (Grob const *refp, int start, int end)
   if (dim_cache_[Y_AXIS].offset_)
     {
       if (to_boolean (get_property ("pure-Y-offset-in-progress")))
-        programming_error ("cyclic chain in pure-Y-offset callbacks");
+        {
+          programming_error ("cyclic chain in pure-Y-offset callbacks");
+          pure_cycle_count_++;
+        }
 
       off = *dim_cache_[Y_AXIS].offset_;
     }
   else
     {
-      SCM proc = get_property_data ("Y-offset");
-
-      dim_cache_[Y_AXIS].offset_ = new Real (0.0);
-      set_property ("pure-Y-offset-in-progress", SCM_BOOL_T);
-      off = robust_scm2double (call_pure_function (proc,
-                                                   scm_list_1 (self_scm ()),
-                                                   start, end),
-                               0.0);
-      del_property ("pure-Y-offset-in-progress");
-      delete dim_cache_[Y_AXIS].offset_;
-      dim_cache_[Y_AXIS].offset_ = 0;
+      /* Like their pure heights, the pure offsets of Items are taken
+         not to depend on the range, so they are cached only once;
+         otherwise every item would keep an offset for each line that
+         page breaking tries. */
+      SCM sym = ly_symbol2scm ("Y-offset");
+      bool per_range = !dynamic_cast<Item *> (this);
+      int key_start = per_range ? start : 0;
+      int key_end = per_range ? end : 0;
+      SCM cached = get_cached_pure_property (sym, key_start, key_end,
+                                             &pure_offset_counter);
+      if (!SCM_UNBNDP (cached))
+        off = scm_to_double (cached);
+      else
+        {
+          SCM proc = get_property_data (sym);
+          int cycles = pure_cycle_count_;
+
+          dim_cache_[Y_AXIS].offset_ = new Real (0.0);
+          set_property ("pure-Y-offset-in-progress", SCM_BOOL_T);
+          off = robust_scm2double (call_pure_function (proc,
+                                                       scm_list_1 (self_scm ()),
+                                                       start, end),
+                                   0.0);
+          del_property ("pure-Y-offset-in-progress");
+          delete dim_cache_[Y_AXIS].offset_;
+          dim_cache_[Y_AXIS].offset_ = 0;
+          if (cycles == pure_cycle_count_)
+            cache_pure_property (sym, key_start, key_end, scm_from_double (off));
+        }
     }
 
   /* we simulate positioning-done if we are the child of a VerticalAlignment,
@@ -43,6 +43,7 @@ class Axis_group_interface
   DECLARE_SCHEME_CALLBACK (combine_skylines, (SCM smob));
   DECLARE_SCHEME_CALLBACK (print, (SCM smob));
   DECLARE_SCHEME_CALLBACK (adjacent_pure_heights, (SCM));
+  DECLARE_SCHEME_CALLBACK (calc_adjacent_pure_height_trees, (SCM));
   DECLARE_SCHEME_CALLBACK (calc_staff_staff_spacing, (SCM));
   DECLARE_SCHEME_CALLBACK (calc_pure_staff_staff_spacing, (SCM, SCM, SCM));
   DECLARE_SCHEME_CALLBACK (calc_pure_relevant_grobs, (SCM));
@@ -53,7 +54,7 @@ class Axis_group_interface
   static Interval relative_maybe_bound_group_extent (vector<Grob *> const &list,
                                                      Grob *common, Axis, bool);
   static Interval relative_pure_height (Grob *me, int start, int end);
-  static Interval combine_pure_heights (Grob *me, SCM, int, int);
+  static Interval combine_pure_heights (Grob *me, Interval_union_tree const *, int, int);
   static Interval sum_partial_pure_heights (Grob *me, int, int);
   static Interval begin_of_line_pure_height (Grob *me, int);
   static Interval rest_of_line_pure_height (Grob *me, int, int);
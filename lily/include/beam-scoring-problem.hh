@@ -116,7 +116,7 @@ class Beam_scoring_problem
 {
 public:
   Beam_scoring_problem (Grob *me, Drul_array<Real> ys, bool);
-  Drul_array<Real> solve () const;
+  Drul_array<Real> solve (string *card = 0) const;
 
 private:
   Spanner *beam_;
@@ -125,6 +125,16 @@ private:
   bool align_broken_intos_;
   bool do_initial_slope_calculations_;
 
+  /*
+    Grob settings that steer solve (), read up front so that solving
+    does not have to consult the beam.
+  */
+  bool skip_quanting_;
+  bool debug_;
+  bool has_inspect_quants_;
+  Interval inspect_quants_;
+  Interval normalized_endpoints_;
+
   Real staff_space_;
   Real beam_thickness_;
   Real line_thickness_;
@@ -179,8 +189,7 @@ private:
   void shift_region_to_valid ();
 
   void one_scorer (Beam_configuration *config) const;
-  Beam_configuration *force_score (SCM inspect_quants,
-                                   const vector<Beam_configuration *> &configs) const;
+  Beam_configuration *force_score (const vector<Beam_configuration *> &configs) const;
   Real y_at (Real x, Beam_configuration const *c) const;
 
   // Scoring functions:
@@ -190,7 +199,7 @@ private:
   void score_slope_direction (Beam_configuration *config) const;
   void score_slope_musical (Beam_configuration *config) const;
   void score_stem_lengths (Beam_configuration *config) const;
-  void generate_quants (vector<Beam_configuration *> *scores) const;
+  void generate_quants (vector<Real> *quants) const;
   void score_collisions (Beam_configuration *config) const;
 };
 
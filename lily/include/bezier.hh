@@ -39,6 +39,8 @@ public:
   Bezier extract (Real, Real) const;
 
   Real get_other_coordinate (Axis a, Real x) const;
+  void get_other_coordinate (Axis a, vector<Real> const &xs,
+                             vector<Real> *ys) const;
   vector<Real> get_other_coordinates (Axis a, Real x) const;
   vector<Real> solve_point (Axis, Real coordinate) const;
   Real minmax (Axis, Real, Real, Direction) const;
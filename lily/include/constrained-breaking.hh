@@ -24,6 +24,8 @@
 #include "matrix.hh"
 #include "prob.hh"
 
+#include <map>
+
 /*
  * Begin/rest-of-line hack.  This geometrical shape is a crude approximation
  * of Skyline, but it is better than a rectangle.
@@ -163,6 +165,7 @@ public:
 
   int max_system_count (vsize start, vsize end);
   int min_system_count (vsize start, vsize end);
+  bool linear_breaking () const;
 
 private:
   Paper_score *pscore_;
@@ -170,6 +173,7 @@ private:
   vsize systems_;
   bool ragged_right_;
   bool ragged_last_;
+  bool linear_breaking_;
 
   Real system_system_min_distance_;
   Real system_system_padding_;
@@ -194,11 +198,18 @@ private:
   vector<Grob *> all_;
   vector<vsize> breaks_;
 
+  /* the breakpoints chosen by linear_breaks (), by (start, end) */
+  map<pair<vsize, vsize>, vector<vsize> > linear_breaks_;
+
   void initialize ();
   void resize (vsize systems);
 
   Column_x_positions space_line (vsize start_col, vsize end_col);
   vsize prepare_solution (vsize start, vsize end, vsize sys_count);
+  vector<vsize> const &linear_breaks (vsize start, vsize end);
+  vector<Column_x_positions> linear_solution (vsize start, vector<vsize> const &brks);
+  vector<Column_x_positions> table_solve (vsize start, vsize end, vsize sys_count);
+  vector<Column_x_positions> table_best_solution (vsize start, vsize end);
 
   Real combine_demerits (Real force, Real prev_force);
 
@@ -24,6 +24,7 @@
 #include "virtual-methods.hh"
 #include "dimension-cache.hh"
 #include "grob-interface.hh"
+#include "pure-cache.hh"
 
 #include <set>
 
@@ -44,6 +45,11 @@ protected:
   Dimension_cache dim_cache_[NO_AXES];
   Output_def *layout_;
   Grob *original_;
+  Pure_cache *pure_cache_;
+
+  /* Counts the cyclic pure Y-offsets that were taken to be 0.  A pure
+     value computed while this changed is not cached.  */
+  static int pure_cycle_count_;
 
   /* SCM data */
   SCM immutable_property_alist_;
@@ -111,6 +117,8 @@ public:
   SCM internal_get_pure_property (SCM symbol, int start, int end) const;
   SCM internal_get_maybe_pure_property (SCM symbol, bool pure, int start, int end) const;
   SCM internal_get_non_callback_marker_property_data (SCM symbol) const;
+  SCM get_cached_pure_property (SCM sym, int start, int end, Pure_cache::Counter *) const;
+  void cache_pure_property (SCM sym, int start, int end, SCM value) const;
   SCM internal_get_object (SCM symbol) const;
   void internal_set_object (SCM sym, SCM val);
   void internal_del_property (SCM symbol);
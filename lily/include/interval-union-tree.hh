@@ -0,0 +1,45 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef INTERVAL_UNION_TREE_HH
+#define INTERVAL_UNION_TREE_HH
+
+#include "interval.hh"
+#include "smobs.hh"
+#include "std-vector.hh"
+
+/*
+  A segment tree over a fixed list of intervals, answering "what is
+  the union of intervals FROM up to TO" in O(log n) time.  Node i
+  holds the union of nodes 2i and 2i + 1; the leaves are at n ... 2n - 1.
+*/
+class Interval_union_tree : public Simple_smob<Interval_union_tree>
+{
+  vector<Interval> nodes_;
+
+public:
+  static const char * const type_p_name_;
+
+  Interval_union_tree (vector<Interval> const &leaves);
+
+  vsize size () const;
+  Interval union_of (vsize from, vsize to) const;
+};
+
+#endif /* INTERVAL_UNION_TREE_HH */
@@ -30,7 +30,9 @@ struct Keyword_ent
 };
 
 /*
-  junkme, use  hash table.
+  Keywords, sorted by name, with a perfect hash: the constructor looks
+  for a seed under which no two keywords share a slot, so a lookup
+  takes one hash and one string comparison.
 */
 struct Keyword_table
 {
@@ -38,6 +40,13 @@ struct Keyword_table
 
   Keyword_table (Keyword_ent *);
   vsize lookup (char const *s) const;
+
+private:
+  vector<vsize> slots_;
+  unsigned seed_;
+
+  unsigned hash (char const *s) const;
+  bool try_seed (unsigned seed);
 };
 
 #endif // KEYWORD_HH
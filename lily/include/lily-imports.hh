@@ -33,6 +33,7 @@ namespace Guile_user {
   extern Variable module_export_all_x;
 #endif
   extern Variable module_export_x;
+  extern Variable module_observe;
   extern Variable module_public_interface;
   extern Variable module_use_x;
   extern Variable symbol_p;
@@ -31,6 +31,9 @@ bool busy_parsing ();
 void kill_lexer ();
 void set_lexer ();
 
+/* The keywords of the lexer, ending with a null name.  */
+extern Keyword_ent the_key_tab[];
+
 class Lily_lexer : public Smob<Lily_lexer>, public Includable_lexer
 {
 public:
@@ -52,6 +55,11 @@ private:
   Keyword_table *keytable_;
   SCM scopes_;
   SCM start_module_;
+
+  /* symbol -> variable, for lookup_identifier_symbol () */
+  SCM identifier_cache_;
+  unsigned long identifier_cache_generation_;
+  void flush_identifier_cache ();
   Input override_input_;
   SCM eval_scm (SCM, Input, char extra_token = 0);
 public:
@@ -75,6 +75,7 @@ class Grob_info;
 class Grob_properties;
 class Includable_lexer;
 class Input;
+class Interval_union_tree;
 class Item;
 class Key_performer;
 class Keyword_ent;
@@ -95,6 +96,7 @@ class Midi_control_change_announcer;
 class Midi_duration;
 class Midi_dynamic;
 class Midi_event;
+class Midi_event_stream;
 class Midi_header;
 class Midi_instrument;
 class Midi_item;
@@ -133,6 +135,7 @@ class Pitch;
 class Pitch_squash_engraver;
 class Prob;
 class Property_iterator;
+class Pure_cache;
 class Relative_octave_music;
 class Repeated_music;
 class Rhythmic_music_iterator;
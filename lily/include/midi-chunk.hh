@@ -34,7 +34,7 @@ public:
 
   int delta_ticks_;
   Midi_item *midi_;
-  string to_string () const;
+  void write (string *out) const;
 };
 
 /**
@@ -44,8 +44,8 @@ class Midi_chunk
 {
 public:
   void set (const string &header_string, const string &data_string, const string &footer_string);
-  virtual string to_string () const;
-  virtual string data_string () const;
+  void write (string *out) const;
+  virtual void write_data (string *out) const;
   DECLARE_CLASSNAME (Midi_chunk);
   virtual ~Midi_chunk ();
 private:
@@ -75,7 +75,7 @@ public:
   ~Midi_track ();
 
   void add (int, Midi_item *midi);
-  virtual string data_string () const;
+  virtual void write_data (string *out) const;
 };
 
 #endif /* MIDI_CHUNK_HH */
@@ -0,0 +1,72 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MIDI_EVENT_STREAM_HH
+#define MIDI_EVENT_STREAM_HH
+
+#include "lily-proto.hh"
+#include "std-string.hh"
+#include "std-vector.hh"
+
+/*
+  Live MIDI output for -dmidi-stream: the events of every time step
+  are sent as soon as the performers have produced them, instead of
+  after the whole score has been interpreted.
+
+  The stream is a sequence of MIDI track events, as in the body of an
+  MTrk chunk: a delta time in ticks (384 per quarter note) as a
+  variable length quantity, followed by the event.  Consecutive scores
+  follow each other without a gap.  The destination may be a regular
+  file, a named pipe or a Unix domain socket that a player listens on.
+
+  Note-off events are sent once a later time step shows that the note
+  has ended, so that ties are followed.  Unlike the MIDI file, the
+  stream does not merge unisons and does not move percussion staves to
+  channel 10, and crescendos sound at the volume known when the note
+  starts.
+*/
+class Midi_event_stream
+{
+public:
+  static Midi_event_stream *get ();
+
+  void start ();
+  void process (Audio_column *column);
+  void finish ();
+
+private:
+  Midi_event_stream (const string &file_name);
+
+  void open ();
+  void stop_notes (int now_ticks);
+  void stop_note (int ticks, Midi_note *note);
+  void output_event (int ticks, Midi_item *midi);
+  void flush ();
+
+  string file_name_;
+  int fd_;
+  bool is_socket_;
+  string buffer_;
+
+  bool started_;
+  int last_tick_;
+  vector<Midi_note *> sounding_notes_;
+};
+
+#endif /* MIDI_EVENT_STREAM_HH */
@@ -23,7 +23,7 @@
 #include "audio-item.hh"
 #include "std-vector.hh"
 
-string int2midi_varint_string (int i);
+void write_midi_varint (string *out, int i);
 
 /**
    Any piece of midi information.
@@ -40,7 +40,8 @@ public:
 
   static Midi_item *get_midi (Audio_item *a);
 
-  virtual string to_string () const = 0;
+  /* Append the bytes of this event to OUT.  */
+  virtual void write (string *out) const = 0;
 };
 
 class Midi_channel_item : public Midi_item
@@ -57,7 +58,7 @@ class Midi_duration : public Midi_item
 public:
   Midi_duration (Real seconds_f);
 
-  virtual string to_string () const;
+  virtual void write (string *out) const;
   Real seconds_;
 };
 
@@ -70,7 +71,7 @@ public:
   DECLARE_CLASSNAME (Midi_control_change);
   Midi_control_change (Audio_control_change *ai);
   virtual ~Midi_control_change ();
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_control_change *audio_;
 };
@@ -84,7 +85,7 @@ public:
   Midi_instrument (Audio_instrument *);
 
   DECLARE_CLASSNAME (Midi_instrument);
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_instrument *audio_;
 };
@@ -95,7 +96,7 @@ public:
   Midi_key (Audio_key *);
   DECLARE_CLASSNAME (Midi_key);
 
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_key *audio_;
 };
@@ -106,7 +107,7 @@ public:
   Midi_time_signature (Audio_time_signature *);
   DECLARE_CLASSNAME (Midi_time_signature);
 
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_time_signature *audio_;
   int clocks_per_1_;
@@ -120,7 +121,7 @@ public:
 
   int get_semitone_pitch () const;
   int get_fine_tuning () const;
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_note *audio_;
 
@@ -134,7 +135,7 @@ public:
   Midi_note_off (Midi_note *);
   DECLARE_CLASSNAME (Midi_note_off);
 
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Midi_note *on_;
   Byte aftertouch_byte_;
@@ -152,7 +153,7 @@ public:
 
   Midi_text (Audio_text *);
 
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_text *audio_;
 };
@@ -163,7 +164,7 @@ public:
   Midi_piano_pedal (Audio_piano_pedal *);
   DECLARE_CLASSNAME (Midi_piano_pedal);
 
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_piano_pedal *audio_;
 };
@@ -174,7 +175,7 @@ public:
   Midi_tempo (Audio_tempo *);
   DECLARE_CLASSNAME (Midi_tempo);
 
-  virtual string to_string () const;
+  virtual void write (string *out) const;
 
   Audio_tempo *audio_;
 };
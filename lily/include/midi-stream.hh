@@ -27,6 +27,10 @@ using namespace std;
 #include "std-string.hh"
 #include "lily-proto.hh"
 
+/*
+  Chunks are serialized into one contiguous buffer, which goes to the
+  file with a single fwrite when the stream is flushed or destroyed.
+*/
 struct Midi_stream
 {
   Midi_stream (const string &file_name_string);
@@ -34,10 +38,13 @@ struct Midi_stream
 
   void write (const string&);
   void write (Midi_chunk const &);
+  void reserve (size_t size);
+  void flush ();
   void open ();
 
   FILE *out_file_;
   string file_name_string_;
+  string buffer_;
 };
 
 #endif // MIDI_STREAM_HH
@@ -21,13 +21,15 @@
 #ifndef MIDI_WALKER_HH
 #define MIDI_WALKER_HH
 
+#include <map>
+using namespace std;
+
 #include "pqueue.hh"
 #include "lily-proto.hh"
 #include "moment.hh"
 
 struct Midi_note_event : PQueue_ent<int, Midi_note *>
 {
-  bool ignore_;
   Midi_note_event ();
 };
 
@@ -52,6 +54,7 @@ private:
   void do_stop_notes (int);
   void output_event (int, Midi_item *l);
   Midi_item *get_midi (Audio_item *);
+  Midi_note_event &pending_note (int pitch);
   Midi_track *track_;
   bool percussion_;
   bool merge_unisons_;
@@ -60,6 +63,14 @@ private:
   PQueue<Midi_note_event> stop_note_queue;
   int last_tick_;
 
+  /*
+    For each pitch, the entry of STOP_NOTE_QUEUE that will end the
+    sounding note, or an entry with a null VAL.  Queue entries that do
+    not match this are stale and are skipped when they come up.
+  */
+  vector<Midi_note_event> pending_notes_;
+  map<int, Midi_note_event> pending_notes_out_of_range_;
+
   vector<Midi_item *> midi_events_;
 };
 
@@ -157,6 +157,7 @@ protected:
                                 Line_division lower_bound = Line_division (),
                                 Line_division upper_bound = Line_division ());
   void set_to_ideal_line_configuration (vsize start, vsize end);
+  bool linear_line_breaking () const;
 
   vsize current_configuration_count () const;
   Line_division current_configuration (vsize configuration_index) const;
@@ -172,6 +173,8 @@ protected:
   Page_spacing_result pack_systems_on_least_pages (vsize configuration_index,
                                                    vsize first_page_num);
   vsize min_page_count (vsize configuration_index, vsize first_page_num);
+  Real demerits_lower_bound (vsize configuration_index);
+  Real estimated_demerits (vsize configuration_index, vsize first_page_num);
   bool all_lines_stretched (vsize configuration_index);
   Real blank_page_penalty () const;
 
@@ -209,6 +212,26 @@ private:
   vector<Line_details> cached_line_details_;
   vector<Line_details> uncompressed_line_details_;
 
+  /* Line details of the configurations that are not currently
+     cached, indexed by configuration.  Switching between
+     configurations swaps vectors in and out of these, so that
+     revisiting a configuration does not ask the line breakers
+     (and the pure-height callbacks behind them) again. */
+  vector<vector<Line_details> > line_details_store_;
+  vector<vector<Line_details> > uncompressed_line_details_store_;
+  void stash_line_details ();
+  bool restore_line_details (vsize configuration_index);
+
+  /* Page_spacer and min_page_count () results for the cached
+     configuration, so that asking for several page counts reuses
+     the rows of the dynamic program that were already filled out. */
+  Page_spacer *cached_spacer_;
+  vsize cached_spacer_first_page_num_;
+  vsize cached_min_page_count_;
+  vsize cached_min_page_count_first_page_num_;
+  Page_spacer &cached_spacer (vsize configuration_index, vsize first_page_num);
+  void clear_spacing_cache ();
+
   Real paper_height_;
   mutable vector<Real> page_height_cache_;
   mutable vector<Real> last_page_height_cache_;
@@ -233,6 +256,13 @@ private:
   void create_system_list ();
   void find_chunks_and_breaks (Break_predicate, Prob_break_predicate);
   SCM make_page (int page_num, bool last) const;
+
+  /* Pages built by page_height (), kept for make_pages; see
+     cached_page (). */
+  SCM page_cache_;
+  SCM page_cache_key (int page_num, bool last) const;
+  SCM cached_page (int page_num, bool last) const;
+  SCM take_cached_page (int page_num, bool last);
   SCM get_page_configuration (SCM systems, int page_num, bool ragged, bool last);
   SCM draw_page (SCM systems, SCM config, int page_num, bool last);
 };
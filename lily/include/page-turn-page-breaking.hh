@@ -70,6 +70,8 @@ protected:
   SCM make_lines (vector<Break_node> *breaks);
   SCM make_pages (vector<Break_node> const &breaks, SCM systems);
 
+  int start_page_number (vsize start) const;
+  vector<vsize> candidate_starts (vsize end, vsize count);
   void calc_subproblem (vsize i);
   void print_break_node (Break_node const &b);
 };
@@ -22,6 +22,7 @@
 
 #include "std-vector.hh"
 #include "music-output.hh"
+#include "warn.hh"
 
 /* MIDI output.  */
 class Performance : public Music_output
@@ -41,6 +42,10 @@ public:
   void remap_grace_durations ();
   void output (Midi_stream &midi_stream, const string &performance_name) const;
   void output_header_track (Midi_stream &midi_stream) const;
+  void output_track (vsize i, int start_tick, string *out) const;
+  void output_tracks_forked (int jobs, int start_tick,
+                             vector<string> *tracks,
+                             vector<vector<Held_message> > *messages) const;
 
   void print () const;
   void write_output (string filename, const string &performance_name) const;
@@ -0,0 +1,74 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PURE_CACHE_HH
+#define PURE_CACHE_HH
+
+#include "lily-guile.hh"
+
+#include <map>
+
+/*
+  Results of pure queries on one grob, indexed by (name start . end),
+  where name is a symbol, and start and end are the ranks of the first
+  and last column of the line.  Looking up a value does not allocate.
+*/
+class Pure_cache
+{
+public:
+  /*
+    Hit and miss counts for one kind of pure query.  Counters are
+    static objects; they chain themselves into a list at startup, so
+    that ly:pure-cache-statistics can find them.
+  */
+  class Counter
+  {
+    char const *name_;
+    long hits_;
+    long misses_;
+    Counter *next_;
+
+    friend class Pure_cache;
+  public:
+    Counter (char const *name);
+    void hit () { hits_++; }
+    void miss () { misses_++; }
+  };
+
+  SCM get (SCM sym, int start, int end, Counter *counter) const;
+  void set (SCM sym, int start, int end, SCM val);
+  void gc_mark () const;
+
+  static SCM statistics ();
+
+private:
+  struct Key
+  {
+    SCM sym_;
+    int start_;
+    int end_;
+
+    Key (SCM sym, int start, int end);
+    bool operator < (Key const &other) const;
+  };
+
+  map<Key, SCM> values_;
+};
+
+#endif /* PURE_CACHE_HH */
@@ -52,6 +52,7 @@ private:
   void header (Midi_stream &);
 
   Audio_column *audio_column_;
+  Midi_event_stream *event_stream_;
   bool skipping_;
   Moment skip_start_mom_;
   Moment offset_mom_;
@@ -42,12 +42,11 @@ public:
   Real force () const;
   Real force_penalty (bool ragged) const;
   bool fits () const;
-
+  Real rod_force (int l, int r, Real dist) const;
 
 private:
   Real expand_line ();
   Real compress_line ();
-  Real rod_force (int l, int r, Real dist);
 
   vector<Spring> springs_;
   Real line_len_;
@@ -33,6 +33,12 @@ struct Extra_collision_info
   Grob *grob_;
   SCM type_;
 
+  /*
+    Bound of the slur whose head overlaps this (item) grob
+    horizontally, or CENTER.  Precomputed for the scoring.
+  */
+  Direction bound_dir_;
+
   Extra_collision_info (Grob *g, Real idx, Interval x, Interval y, Real p);
   Extra_collision_info ();
 };
@@ -70,6 +76,9 @@ struct Bound_info
   Interval slur_head_x_extent_;
   Real staff_space_;
 
+  // Number of beams on the stem, on the side facing the slur.
+  int inner_beam_count_;
+
   Bound_info ()
   {
     stem_ = 0;
@@ -77,6 +86,7 @@ struct Bound_info
     slur_head_ = 0;
     stem_dir_ = CENTER;
     note_column_ = 0;
+    inner_beam_count_ = 0;
   }
 };
 
@@ -93,6 +103,7 @@ struct Slur_score_state
   vector<Grob *> columns_;
   vector<Encompass_info> encompass_infos_;
   vector<Extra_collision_info> extra_encompass_infos_;
+  vector<Offset> forbidden_attachments_;
 
   Direction dir_;
   Slur_score_parameters parameters_;
@@ -119,6 +130,7 @@ struct Slur_score_state
   Drul_array<Real> get_y_attachment_range () const;
   Encompass_info get_encompass_info (Grob *col) const;
   vector<Extra_collision_info> get_extra_encompass_infos () const;
+  vector<Offset> get_forbidden_attachments () const;
   Real move_away_from_staffline (Real y, Grob *on_staff) const;
 
   Interval breakable_bound_extent (Direction) const;
@@ -27,6 +27,8 @@
 #include <iostream>
 using namespace std;
 
+struct File_contents;
+
 /**
    class for reading and mapping a file.
 
@@ -43,13 +45,28 @@ public:
   static const char * const type_p_name_;
   virtual ~Source_file ();
 private:
-  vector<char const *> newline_locations_;
+  /* built on first use, since only locations that get reported need
+     line numbers */
+  mutable vector<char const *> newline_locations_;
+  mutable bool newlines_found_;
   istream *istream_;
+  streambuf *streambuf_;
+
+  /* The contents, 0-terminated.  Files are shared through CONTENTS_
+     by all Source_files for them, and large ones are mapped into
+     memory; CHARACTERS_ only holds strings and standard input.  */
   vector<char> characters_;
-  SCM str_port_;
+  char const *data_;
+  vsize length_;
+  File_contents *contents_;
+
+  /* made on first use, since it copies the contents into a Scheme
+     string */
+  mutable SCM str_port_;
 
   void load_stdin ();
-  void init_port ();
+  void set_characters ();
+  void find_newlines () const;
   void init ();
 
 public:
@@ -78,12 +78,7 @@ public:
   virtual void derived_mark () const;
   virtual System *get_system () const;
 
-  SCM get_cached_pure_property (SCM sym, int start, int end);
-  void cache_pure_property (SCM sym, int start, int end, SCM value);
-
 protected:
-  SCM pure_property_cache_;
-
   void set_my_columns ();
   virtual Grob *clone () const;
   virtual void do_break_processing ();
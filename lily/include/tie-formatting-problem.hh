@@ -78,6 +78,7 @@ class Tie_formatting_problem
   void score_ties (Ties_configuration *) const;
 
   Slice head_positions_slice (int) const;
+  void set_specification_head_info ();
   Ties_configuration generate_base_chord_configuration ();
   Ties_configuration find_best_variation (Ties_configuration const &base,
                                           vector<Tie_configuration_variation> const &vars);
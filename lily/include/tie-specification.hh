@@ -22,6 +22,7 @@
 
 #include "lily-proto.hh"
 #include "drul-array.hh"
+#include "interval.hh"
 
 struct Tie_specification
 {
@@ -38,6 +39,14 @@ struct Tie_specification
   Real manual_position_;
   Direction manual_dir_;
 
+  /*
+    Looked up from the note heads before scoring: their X-extents
+    relative to the common refpoint of the problem, and the direction
+    of their stems (CENTER if the stem is missing or not normal).
+  */
+  Drul_array<Interval> note_head_x_extent_drul_;
+  Drul_array<Direction> stem_dir_drul_;
+
   Tie_specification ();
   int column_span () const;
   void from_grob (Grob *);
@@ -0,0 +1,61 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "interval-union-tree.hh"
+
+const char * const Interval_union_tree::type_p_name_ = "ly:interval-union-tree?";
+
+Interval_union_tree::Interval_union_tree (vector<Interval> const &leaves)
+{
+  vsize n = leaves.size ();
+  nodes_.resize (2 * n);
+  for (vsize i = 0; i < n; i++)
+    nodes_[n + i] = leaves[i];
+  for (vsize i = n; i-- > 1;)
+    {
+      nodes_[i] = nodes_[2 * i];
+      nodes_[i].unite (nodes_[2 * i + 1]);
+    }
+}
+
+vsize
+Interval_union_tree::size () const
+{
+  return nodes_.size () / 2;
+}
+
+/*
+  Union of leaves FROM up to (not including) TO.  Since a union of
+  intervals does not depend on the order in which they are combined,
+  the result is exactly what uniting the leaves one by one gives.
+*/
+Interval
+Interval_union_tree::union_of (vsize from, vsize to) const
+{
+  Interval ret;
+  vsize n = size ();
+  for (from += n, to += n; from < to; from /= 2, to /= 2)
+    {
+      if (from & 1)
+        ret.unite (nodes_[from++]);
+      if (to & 1)
+        ret.unite (nodes_[--to]);
+    }
+  return ret;
+}
@@ -20,15 +20,58 @@ Keyword_table::Keyword_table (Keyword_ent *tab)
     table_.push_back (*tab++);
 
   vector_sort (table_, tab_less);
+
+  /*
+    With four slots per keyword, a random seed is collision-free often
+    enough that the search takes a few dozen tries; grow the table in
+    the unlikely case that it does not.
+  */
+  vsize size = 4;
+  while (size < 4 * table_.size ())
+    size *= 2;
+  for (;;)
+    {
+      slots_.assign (size, VPOS);
+      for (unsigned seed = 0; seed < 1024; seed++)
+        if (try_seed (seed))
+          return;
+      size *= 2;
+    }
+}
+
+/* FNV-1a, starting from SEED */
+unsigned
+Keyword_table::hash (char const *s) const
+{
+  unsigned h = 2166136261U ^ seed_;
+  for (; *s; s++)
+    {
+      h ^= (unsigned char) *s;
+      h *= 16777619U;
+    }
+  return h & (unsigned) (slots_.size () - 1);
+}
+
+bool
+Keyword_table::try_seed (unsigned seed)
+{
+  seed_ = seed;
+  slots_.assign (slots_.size (), VPOS);
+  for (vsize i = 0; i < table_.size (); i++)
+    {
+      unsigned h = hash (table_[i].name_);
+      if (slots_[h] != VPOS)
+        return false;
+      slots_[h] = i;
+    }
+  return true;
 }
 
 vsize
 Keyword_table::lookup (char const *s) const
 {
-  Keyword_ent e;
-  e.name_ = s;
-  vsize idx = binary_search (table_, e, tab_less);
-  if (idx != VPOS)
+  vsize idx = slots_[hash (s)];
+  if (idx != VPOS && !strcmp (table_[idx].name_, s))
     return table_[idx].tokcode_;
   return VPOS;
 }
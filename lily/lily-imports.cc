@@ -29,6 +29,7 @@ namespace Guile_user {
   Variable module_export_all_x ("module-export-all!");
 #endif
   Variable module_export_x ("module-export!");
+  Variable module_observe ("module-observe");
   Variable module_public_interface ("module-public-interface");
   Variable module_use_x ("module-use!");
   Variable symbol_p ("symbol?");
@@ -35,9 +35,10 @@ using namespace std;
 #include "warn.hh"
 #include "program-option.hh"
 #include "lily-parser.hh"
+#include "lily-imports.hh"
 #include "ly-module.hh"
 
-static Keyword_ent the_key_tab[]
+Keyword_ent the_key_tab[]
 =
 {
   {"accepts", ACCEPTS},
@@ -88,6 +89,39 @@ static Keyword_ent the_key_tab[]
   {0, 0}
 };
 
+/*
+  Looking up an identifier walks the scopes and the modules they use,
+  which is most of the work of lexing a \command.  Lexers cache the
+  variables they find.  Any new definition in a scope module, in the
+  public interface of (lily) or in the root module bumps
+  definition_generation, which empties all caches.
+*/
+static unsigned long definition_generation = 0;
+
+static SCM
+note_definition (SCM /* module */)
+{
+  definition_generation++;
+  return SCM_UNSPECIFIED;
+}
+
+static void
+observe_definitions (SCM module)
+{
+  static SCM observer = SCM_BOOL_F;
+  if (scm_is_false (observer))
+    {
+      observer = scm_c_make_gsubr ("note-definition", 1, 0, 0,
+                                   (scm_t_subr) note_definition);
+      scm_gc_protect_object (observer);
+
+      Guile_user::module_observe (Guile_user::the_root_module, observer);
+      Guile_user::module_observe
+        (Guile_user::module_public_interface (Lily::module), observer);
+    }
+  Guile_user::module_observe (module, observer);
+}
+
 Lily_lexer::Lily_lexer (Sources *sources, Lily_parser *parser)
 {
   parser_ = parser;
@@ -101,6 +135,8 @@ Lily_lexer::Lily_lexer (Sources *sources, Lily_parser *parser)
   main_input_level_ = 0;
   start_module_ = SCM_EOL;
   extra_tokens_ = SCM_EOL;
+  identifier_cache_ = SCM_EOL;
+  identifier_cache_generation_ = 0;
   smobify_self ();
 
   add_scope (ly_make_module (false));
@@ -125,11 +161,15 @@ Lily_lexer::Lily_lexer (Lily_lexer const &src, Lily_parser *parser,
   main_input_level_ = 0;
 
   extra_tokens_ = SCM_EOL;
+  identifier_cache_ = SCM_EOL;
+  identifier_cache_generation_ = 0;
   if (unsmob<Input> (override_input))
     override_input_ = *unsmob<Input> (override_input);
 
   smobify_self ();
 
+  flush_identifier_cache ();
+
   push_note_state (SCM_EOL);
 }
 
@@ -148,6 +188,8 @@ Lily_lexer::add_scope (SCM module)
   for (SCM s = scopes_; scm_is_pair (s); s = scm_cdr (s))
     ly_use_module (module, scm_car (s));
   scopes_ = scm_cons (module, scopes_);
+  observe_definitions (module);
+  flush_identifier_cache ();
 
   set_current_scope ();
 }
@@ -162,6 +204,7 @@ Lily_lexer::remove_scope ()
 {
   SCM sc = scm_car (scopes_);
   scopes_ = scm_cdr (scopes_);
+  flush_identifier_cache ();
   set_current_scope ();
   return sc;
 }
@@ -205,17 +248,32 @@ Lily_lexer::keyword_list () const
   return l;
 }
 
+void
+Lily_lexer::flush_identifier_cache ()
+{
+  identifier_cache_ = scm_c_make_hash_table (61);
+  identifier_cache_generation_ = definition_generation;
+}
+
 SCM
 Lily_lexer::lookup_identifier_symbol (SCM sym)
 {
-  for (SCM s = scopes_; scm_is_pair (s); s = scm_cdr (s))
+  if (identifier_cache_generation_ != definition_generation)
+    flush_identifier_cache ();
+
+  SCM var = scm_hashq_ref (identifier_cache_, sym, SCM_BOOL_F);
+  if (scm_is_false (var))
     {
-      SCM var = ly_module_lookup (scm_car (s), sym);
-      if (scm_is_true (var))
-        return scm_variable_ref (var);
+      for (SCM s = scopes_; scm_is_false (var) && scm_is_pair (s);
+           s = scm_cdr (s))
+        var = ly_module_lookup (scm_car (s), sym);
+
+      if (scm_is_false (var))
+        return SCM_UNDEFINED;
+      scm_hashq_set_x (identifier_cache_, sym, var);
     }
 
-  return SCM_UNDEFINED;
+  return scm_variable_ref (var);
 }
 
 SCM
@@ -382,6 +440,7 @@ Lily_lexer::mark_smob () const
   scm_gc_mark (pitchname_tab_stack_);
   scm_gc_mark (start_module_);
   scm_gc_mark (extra_tokens_);
+  scm_gc_mark (identifier_cache_);
   return scopes_;
 }
 
@@ -118,17 +118,14 @@ Midi_track::add (int delta_ticks, Midi_item *midi)
   events_.insert (position, e);
 }
 
-string
-Midi_track::data_string () const
+void
+Midi_track::write_data (string *out) const
 {
-  string str = Midi_chunk::data_string ();
+  Midi_chunk::write_data (out);
 
   for (vector<Midi_event *>::const_iterator i (events_.begin ());
        i != events_.end (); i++)
-    {
-      str += (*i)->to_string ();
-    }
-  return str;
+    (*i)->write (out);
 }
 
 Midi_track::~Midi_track ()
@@ -145,12 +142,11 @@ Midi_event::Midi_event (int delta_ticks, Midi_item *midi)
   midi_ = midi;
 }
 
-string
-Midi_event::to_string () const
+void
+Midi_event::write (string *out) const
 {
-  string delta_string = int2midi_varint_string (delta_ticks_);
-  string midi_string = midi_->to_string ();
-  return delta_string + midi_string;
+  write_midi_varint (out, delta_ticks_);
+  midi_->write (out);
 }
 /****************************************************************
  header
@@ -188,25 +184,27 @@ Midi_chunk::set (const string &header_string, const string &data_string, const s
   header_string_ = header_string;
 }
 
-string
-Midi_chunk::data_string () const
+void
+Midi_chunk::write_data (string *out) const
 {
-  return data_string_;
+  *out += data_string_;
 }
 
-string
-Midi_chunk::to_string () const
+/*
+  Append the chunk to OUT.  The data is written in place after a
+  placeholder for its length, which is filled in afterwards.
+*/
+void
+Midi_chunk::write (string *out) const
 {
-  string str = header_string_;
-  string dat = data_string ();
-  string length_string = String_convert::int2hex (dat.length ()
-                                                  + footer_string_.length (), 8, '0');
-  length_string = String_convert::hex2bin (length_string);
+  *out += header_string_;
+  vsize length_pos = out->length ();
+  out->append (4, '\0');
 
-  str += length_string;
-  str += dat;
-  str += footer_string_;
+  write_data (out);
+  *out += footer_string_;
 
-  return str;
+  vsize length = out->length () - length_pos - 4;
+  for (int i = 0; i < 4; i++)
+    (*out)[length_pos + i] = (char) (length >> (8 * (3 - i)));
 }
-
@@ -0,0 +1,270 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "midi-event-stream.hh"
+
+#include "config.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#if HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#if HAVE_SYS_SOCKET_H && HAVE_SYS_UN_H
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+using namespace std;
+
+#include "audio-column.hh"
+#include "audio-item.hh"
+#include "international.hh"
+#include "lily-guile.hh"
+#include "midi-item.hh"
+#include "program-option.hh"
+#include "warn.hh"
+
+Midi_event_stream *
+Midi_event_stream::get ()
+{
+  static Midi_event_stream *stream = 0;
+  if (!stream)
+    {
+      /* -dmidi-stream=FILE gives a symbol, -dmidi-stream='"FILE"' a
+         string.  */
+      SCM file_name = ly_get_option (ly_symbol2scm ("midi-stream"));
+      if (ly_is_symbol (file_name))
+        stream = new Midi_event_stream (ly_symbol2string (file_name));
+      else if (scm_is_string (file_name))
+        stream = new Midi_event_stream (ly_scm2string (file_name));
+    }
+  return stream;
+}
+
+Midi_event_stream::Midi_event_stream (const string &file_name)
+  : file_name_ (file_name),
+    fd_ (-1),
+    is_socket_ (false),
+    started_ (false),
+    last_tick_ (0)
+{
+  open ();
+}
+
+void
+Midi_event_stream::open ()
+{
+#if HAVE_SYS_STAT_H && HAVE_SYS_SOCKET_H && HAVE_SYS_UN_H
+  struct stat st;
+  if (!stat (file_name_.c_str (), &st) && S_ISSOCK (st.st_mode))
+    {
+      is_socket_ = true;
+
+      struct sockaddr_un address;
+      if (file_name_.length () >= sizeof (address.sun_path))
+        {
+          warning (_f ("socket name too long: %s", file_name_.c_str ()));
+          return;
+        }
+      memset (&address, 0, sizeof (address));
+      address.sun_family = AF_UNIX;
+      strcpy (address.sun_path, file_name_.c_str ());
+
+      fd_ = socket (AF_UNIX, SOCK_STREAM, 0);
+      if (fd_ >= 0
+          && connect (fd_, (struct sockaddr *) &address, sizeof (address)))
+        {
+          int connect_errno = errno;
+          close (fd_);
+          fd_ = -1;
+          errno = connect_errno;
+        }
+    }
+  else
+#endif
+    fd_ = ::open (file_name_.c_str (), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+  if (fd_ < 0)
+    warning (_f ("cannot open for write: %s: %s",
+                 file_name_.c_str (), strerror (errno)));
+}
+
+/*
+  Start a new score.  Its first event follows the last event of the
+  previous score without delay.
+*/
+void
+Midi_event_stream::start ()
+{
+  started_ = false;
+}
+
+void
+Midi_event_stream::process (Audio_column *column)
+{
+  int now_ticks = column->ticks ();
+  if (!started_)
+    {
+      last_tick_ = now_ticks;
+      started_ = true;
+    }
+
+  stop_notes (now_ticks);
+
+  for (vsize i = 0; i < column->audio_items_.size (); i++)
+    {
+      Midi_item *midi = Midi_item::get_midi (column->audio_items_[i]);
+      if (!midi)
+        continue;
+
+      Midi_note *note = dynamic_cast<Midi_note *> (midi);
+      if (!note)
+        {
+          output_event (now_ticks, midi);
+          delete midi;
+          continue;
+        }
+
+      /* Continuations of a tie have no length of their own.  */
+      if (!note->audio_->length_mom_.to_bool ())
+        {
+          delete note;
+          continue;
+        }
+
+      /* Restrike a pitch that is still sounding on this channel.  */
+      int pitch = note->get_semitone_pitch ();
+      for (vsize j = 0; j < sounding_notes_.size (); j++)
+        if (sounding_notes_[j]->channel_ == note->channel_
+            && sounding_notes_[j]->get_semitone_pitch () == pitch)
+          {
+            stop_note (now_ticks, sounding_notes_[j]);
+            sounding_notes_.erase (sounding_notes_.begin () + j);
+            break;
+          }
+
+      output_event (now_ticks, note);
+      sounding_notes_.push_back (note);
+    }
+
+  flush ();
+}
+
+/*
+  Send the notes that are still sounding at the end of the score.
+*/
+void
+Midi_event_stream::finish ()
+{
+  stop_notes (INT_MAX);
+  flush ();
+}
+
+static int
+note_stop_ticks (Midi_note *note)
+{
+  Audio_note *audio = note->audio_;
+  return int (moment_to_real (audio->length_mom_) * Real (384 * 4))
+         + audio->audio_column_->ticks ();
+}
+
+static bool
+stops_earlier (Midi_note *a, Midi_note *b)
+{
+  return note_stop_ticks (a) < note_stop_ticks (b);
+}
+
+/*
+  Stop the notes that end before or at NOW_TICKS.  A tie lengthens its
+  first note when the tied note comes in, so the end of a note is only
+  certain once a later time step has been processed.
+*/
+void
+Midi_event_stream::stop_notes (int now_ticks)
+{
+  vector<Midi_note *> ending;
+  vector<Midi_note *> sounding;
+  for (vsize i = 0; i < sounding_notes_.size (); i++)
+    if (note_stop_ticks (sounding_notes_[i]) <= now_ticks)
+      ending.push_back (sounding_notes_[i]);
+    else
+      sounding.push_back (sounding_notes_[i]);
+
+  stable_sort (ending.begin (), ending.end (), stops_earlier);
+  for (vsize i = 0; i < ending.size (); i++)
+    stop_note (note_stop_ticks (ending[i]), ending[i]);
+
+  sounding_notes_.swap (sounding);
+}
+
+void
+Midi_event_stream::stop_note (int ticks, Midi_note *note)
+{
+  Midi_note_off off (note);
+  output_event (ticks, &off);
+  delete note;
+}
+
+void
+Midi_event_stream::output_event (int ticks, Midi_item *midi)
+{
+  int delta_ticks = ticks - last_tick_;
+  if (delta_ticks < 0)
+    delta_ticks = 0;
+  else
+    last_tick_ = ticks;
+
+  write_midi_varint (&buffer_, delta_ticks);
+  midi->write (&buffer_);
+}
+
+void
+Midi_event_stream::flush ()
+{
+  size_t done = 0;
+  while (fd_ >= 0 && done < buffer_.length ())
+    {
+      char const *data = buffer_.data () + done;
+      size_t size = buffer_.length () - done;
+      ssize_t written;
+#if defined (MSG_NOSIGNAL)
+      /* A player that goes away must not kill us with SIGPIPE.  */
+      if (is_socket_)
+        written = send (fd_, data, size, MSG_NOSIGNAL);
+      else
+#endif
+        written = write (fd_, data, size);
+
+      if (written < 0 && errno == EINTR)
+        continue;
+      if (written < 0)
+        {
+          warning (_f ("cannot write to file: `%s'", file_name_.c_str ()));
+          close (fd_);
+          fd_ = -1;
+          break;
+        }
+      done += written;
+    }
+
+  buffer_.clear ();
+}
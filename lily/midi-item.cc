@@ -64,10 +64,10 @@ Midi_duration::Midi_duration (Real seconds_f)
   seconds_ = seconds_f;
 }
 
-string
-Midi_duration::to_string () const
+void
+Midi_duration::write (string *out) const
 {
-  return string ("<duration: ") + ::to_string (seconds_) + ">";
+  *out += string ("<duration: ") + ::to_string (seconds_) + ">";
 }
 
 Midi_instrument::Midi_instrument (Audio_instrument *a)
@@ -77,8 +77,8 @@ Midi_instrument::Midi_instrument (Audio_instrument *a)
   audio_->str_ = String_convert::to_lower (audio_->str_);
 }
 
-string
-Midi_instrument::to_string () const
+void
+Midi_instrument::write (string *out) const
 {
   Byte program_byte = 0;
   bool found = false;
@@ -90,9 +90,8 @@ Midi_instrument::to_string () const
   else
     warning (_f ("no such MIDI instrument: `%s'", audio_->str_.c_str ()));
 
-  string str = ::to_string ((char) (0xc0 + channel_)); //YIKES! FIXME : Should be track. -rz
-  str += ::to_string ((char)program_byte);
-  return str;
+  *out += (char) (0xc0 + channel_); //YIKES! FIXME : Should be track. -rz
+  *out += (char) program_byte;
 }
 
 Midi_item::Midi_item ()
@@ -122,8 +121,8 @@ Midi_control_change::~Midi_control_change ()
 {
 }
 
-string
-int2midi_varint_string (int i)
+void
+write_midi_varint (string *out, int i)
 {
   int buffer = i & 0x7f;
   while ((i >>= 7) > 0)
@@ -133,16 +132,14 @@ int2midi_varint_string (int i)
       buffer += (i & 0x7f);
     }
 
-  string str;
   while (1)
     {
-      str += ::to_string ((char)buffer);
+      *out += (char)buffer;
       if (buffer & 0x80)
         buffer >>= 8;
       else
         break;
     }
-  return str;
 }
 
 Midi_key::Midi_key (Audio_key *a)
@@ -150,16 +147,14 @@ Midi_key::Midi_key (Audio_key *a)
 {
 }
 
-string
-Midi_key::to_string () const
+void
+Midi_key::write (string *out) const
 {
-  string str = "ff5902";
-  str += String_convert::int2hex (audio_->accidentals_, 2, '0');
-  if (audio_->major_)
-    str += String_convert::int2hex (0, 2, '0');
-  else
-    str += String_convert::int2hex (1, 2, '0');
-  return String_convert::hex2bin (str);
+  *out += (char) 0xff;
+  *out += (char) 0x59;
+  *out += (char) 0x02;
+  *out += (char) audio_->accidentals_;
+  *out += (char) (audio_->major_ ? 0 : 1);
 }
 
 Midi_time_signature::Midi_time_signature (Audio_time_signature *a)
@@ -168,8 +163,8 @@ Midi_time_signature::Midi_time_signature (Audio_time_signature *a)
 {
 }
 
-string
-Midi_time_signature::to_string () const
+void
+Midi_time_signature::write (string *out) const
 {
   int num = abs (audio_->beats_);
   if (num > 255)
@@ -180,12 +175,13 @@ Midi_time_signature::to_string () const
 
   int den = audio_->one_beat_;
 
-  string str = "ff5804";
-  str += String_convert::int2hex (num, 2, '0');
-  str += String_convert::int2hex (intlog2 (den), 2, '0');
-  str += String_convert::int2hex (clocks_per_1_, 2, '0');
-  str += String_convert::int2hex (8, 2, '0');
-  return String_convert::hex2bin (str);
+  *out += (char) 0xff;
+  *out += (char) 0x58;
+  *out += (char) 0x04;
+  *out += (char) num;
+  *out += (char) intlog2 (den);
+  *out += (char) clocks_per_1_;
+  *out += (char) 8;
 }
 
 Midi_note::Midi_note (Audio_note *a)
@@ -217,29 +213,26 @@ Midi_note::get_semitone_pitch () const
   return int (rint (tune));
 }
 
-string
-Midi_note::to_string () const
+void
+Midi_note::write (string *out) const
 {
   Byte status_byte = (char) (0x90 + channel_);
-  string str = "";
-  int finetune;
+  int fine_tuning = get_fine_tuning ();
 
   // print warning if fine tuning was needed, HJJ
-  if (get_fine_tuning () != 0)
+  if (fine_tuning != 0)
     {
-      finetune = PITCH_WHEEL_CENTER + get_fine_tuning ();
+      int finetune = PITCH_WHEEL_CENTER + fine_tuning;
 
-      str += ::to_string ((char) (0xE0 + channel_));
-      str += ::to_string ((char) (finetune & 0x7F));
-      str += ::to_string ((char) (finetune >> 7));
-      str += ::to_string ((char) (0x00));
+      *out += (char) (0xE0 + channel_);
+      *out += (char) (finetune & 0x7F);
+      *out += (char) (finetune >> 7);
+      *out += (char) (0x00);
     }
 
-  str += ::to_string ((char) status_byte);
-  str += ::to_string ((char) (get_semitone_pitch () + c0_pitch_));
-  str += ::to_string ((char) dynamic_byte_);
-
-  return str;
+  *out += (char) status_byte;
+  *out += (char) (get_semitone_pitch () + c0_pitch_);
+  *out += (char) dynamic_byte_;
 }
 
 Midi_note_off::Midi_note_off (Midi_note *n)
@@ -252,25 +245,23 @@ Midi_note_off::Midi_note_off (Midi_note *n)
   aftertouch_byte_ = 0;
 }
 
-string
-Midi_note_off::to_string () const
+void
+Midi_note_off::write (string *out) const
 {
   Byte status_byte = (char) (0x90 + channel_);
 
-  string str = ::to_string ((char)status_byte);
-  str += ::to_string ((char) (get_semitone_pitch () + Midi_note::c0_pitch_));
-  str += ::to_string ((char)aftertouch_byte_);
+  *out += (char) status_byte;
+  *out += (char) (get_semitone_pitch () + Midi_note::c0_pitch_);
+  *out += (char) aftertouch_byte_;
 
   if (get_fine_tuning () != 0)
     {
       // Move pitch wheel back to the central position.
-      str += ::to_string ((char) 0x00);
-      str += ::to_string ((char) (0xE0 + channel_));
-      str += ::to_string ((char) (PITCH_WHEEL_CENTER & 0x7F));
-      str += ::to_string ((char) (PITCH_WHEEL_CENTER >> 7));
+      *out += (char) 0x00;
+      *out += (char) (0xE0 + channel_);
+      *out += (char) (PITCH_WHEEL_CENTER & 0x7F);
+      *out += (char) (PITCH_WHEEL_CENTER >> 7);
     }
-
-  return str;
 }
 
 Midi_piano_pedal::Midi_piano_pedal (Audio_piano_pedal *a)
@@ -279,22 +270,21 @@ Midi_piano_pedal::Midi_piano_pedal (Audio_piano_pedal *a)
 {
 }
 
-string
-Midi_piano_pedal::to_string () const
+void
+Midi_piano_pedal::write (string *out) const
 {
   Byte status_byte = (char) (0xB0 + channel_);
-  string str = ::to_string ((char)status_byte);
+  *out += (char) status_byte;
 
   if (audio_->type_string_ == "Sostenuto")
-    str += ::to_string ((char)0x42);
+    *out += (char) 0x42;
   else if (audio_->type_string_ == "Sustain")
-    str += ::to_string ((char)0x40);
+    *out += (char) 0x40;
   else if (audio_->type_string_ == "UnaCorda")
-    str += ::to_string ((char)0x43);
+    *out += (char) 0x43;
 
   int pedal = ((1 - audio_->dir_) / 2) * 0x7f;
-  str += ::to_string ((char)pedal);
-  return str;
+  *out += (char) pedal;
 }
 
 Midi_tempo::Midi_tempo (Audio_tempo *a)
@@ -302,13 +292,25 @@ Midi_tempo::Midi_tempo (Audio_tempo *a)
 {
 }
 
-string
-Midi_tempo::to_string () const
+void
+Midi_tempo::write (string *out) const
 {
-  int useconds_per_4 = 60 * (int)1e6 / audio_->per_minute_4_;
-  string str = "ff5103";
-  str += String_convert::int2hex (useconds_per_4, 6, '0');
-  return String_convert::hex2bin (str);
+  /* The tempo is stored in three bytes, which only allows for about
+     four quarter notes per minute.  */
+  int const max_useconds_per_4 = 0xffffff;
+  int useconds_per_4 = max_useconds_per_4;
+  if (audio_->per_minute_4_ > 60 * (int)1e6 / max_useconds_per_4)
+    useconds_per_4 = 60 * (int)1e6 / audio_->per_minute_4_;
+  else
+    warning (_f ("MIDI tempo of %d quarter notes per minute is too slow,"
+                 " using the slowest possible tempo",
+                 audio_->per_minute_4_));
+  *out += (char) 0xff;
+  *out += (char) 0x51;
+  *out += (char) 0x03;
+  *out += (char) (useconds_per_4 >> 16);
+  *out += (char) (useconds_per_4 >> 8);
+  *out += (char) useconds_per_4;
 }
 
 Midi_text::Midi_text (Audio_text *a)
@@ -316,24 +318,22 @@ Midi_text::Midi_text (Audio_text *a)
 {
 }
 
-string
-Midi_text::to_string () const
+void
+Midi_text::write (string *out) const
 {
-  string str = "ff" + String_convert::int2hex (audio_->type_, 2, '0');
-  str = String_convert::hex2bin (str);
-  str += int2midi_varint_string (audio_->text_string_.length ());
-  str += audio_->text_string_;
-  return str;
+  *out += (char) 0xff;
+  *out += (char) audio_->type_;
+  write_midi_varint (out, audio_->text_string_.length ());
+  *out += audio_->text_string_;
 }
 
-string
-Midi_control_change::to_string () const
+void
+Midi_control_change::write (string *out) const
 {
   Byte status_byte = (char) (0xB0 + channel_);
-  string str = ::to_string ((char)status_byte);
-  str += ::to_string ((char) (audio_->control_));
-  str += ::to_string ((char) (audio_->value_));
-  return str;
+  *out += (char) status_byte;
+  *out += (char) (audio_->control_);
+  *out += (char) (audio_->value_);
 }
 
 char const *
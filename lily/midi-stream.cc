@@ -40,25 +40,37 @@ Midi_stream::Midi_stream (const string &file_name)
 
 Midi_stream::~Midi_stream ()
 {
+  flush ();
   fclose (out_file_);
 }
 
 void
-Midi_stream::write (const string &str)
+Midi_stream::reserve (size_t size)
+{
+  buffer_.reserve (size);
+}
+
+void
+Midi_stream::flush ()
 {
   size_t sz = sizeof (Byte);
-  size_t n = str.length ();
-  size_t written = fwrite (str.data (), sz, n, out_file_);
+  size_t n = buffer_.length ();
+  size_t written = fwrite (buffer_.data (), sz, n, out_file_);
 
   if (written != sz * n)
     warning (_f ("cannot write to file: `%s'", file_name_string_.c_str ()));
+
+  buffer_.clear ();
 }
 
 void
-Midi_stream::write (Midi_chunk const &midi)
+Midi_stream::write (const string &str)
 {
-  string str = midi.to_string ();
-
-  return write (str);
+  buffer_ += str;
 }
 
+void
+Midi_stream::write (Midi_chunk const &midi)
+{
+  midi.write (&buffer_);
+}
@@ -29,7 +29,8 @@
 
 Midi_note_event::Midi_note_event ()
 {
-  ignore_ = false;
+  val = 0;
+  key = 0;
 }
 
 int
@@ -63,6 +64,7 @@ Midi_walker::Midi_walker (Audio_staff *audio_staff, Midi_track *track, int start
   last_tick_ = start_tick;
   percussion_ = audio_staff->percussion_;
   merge_unisons_ = audio_staff->merge_unisons_;
+  pending_notes_.resize (128);
 }
 
 Midi_walker::~Midi_walker ()
@@ -87,43 +89,34 @@ Midi_walker::do_start_note (Midi_note *note)
   int now_ticks = ptr->audio_column_->ticks ();
   int stop_ticks = int (moment_to_real (note->audio_->length_mom_) *
                         Real (384 * 4)) + now_ticks;
-  for (vsize i = 0; i < stop_note_queue.size (); i++)
+
+  /* if this pitch is already sounding */
+  Midi_note_event &pending = pending_note (note->get_semitone_pitch ());
+  if (pending.val)
     {
-      /* if this pitch already in queue, and is not already ignored */
-      if (!stop_note_queue[i].ignore_ &&
-          stop_note_queue[i].val->get_semitone_pitch ()
-          == note->get_semitone_pitch ())
+      int queued_ticks = pending.val->audio_->audio_column_->ticks ();
+      // If the two notes started at the same time, or option is set,
+      if (now_ticks == queued_ticks || merge_unisons_)
         {
-          int queued_ticks
-            = stop_note_queue[i].val->audio_->audio_column_->ticks ();
-          // If the two notes started at the same time, or option is set,
-          if (now_ticks == queued_ticks || merge_unisons_)
+          // merge them.
+          if (pending.key < stop_ticks)
             {
-              // merge them.
-              if (stop_note_queue[i].key < stop_ticks)
-                {
-                  Midi_note_event e;
-                  e.val = stop_note_queue[i].val;
-                  e.key = stop_ticks;
-                  stop_note_queue[i].ignore_ = true;
-                  stop_note_queue.insert (e);
-                }
-              note = 0;
-              break;
+              pending.key = stop_ticks;
+              stop_note_queue.insert (pending);
             }
-          else
+          note = 0;
+        }
+      else
+        {
+          // A note was played that interruped a played note.
+          // Stop the old note, and continue to the greatest moment
+          // between the two.
+          if (pending.key > stop_ticks)
             {
-              // A note was played that interruped a played note.
-              // Stop the old note, and continue to the greatest moment
-              // between the two.
-              if (stop_note_queue[i].key > stop_ticks)
-                {
-                  stop_ticks = stop_note_queue[i].key;
-                }
-              output_event (now_ticks, stop_note_queue[i].val);
-              stop_note_queue[i].ignore_ = true;
-              break;
+              stop_ticks = pending.key;
             }
+          output_event (now_ticks, pending.val);
+          pending.val = 0;
         }
     }
 
@@ -135,6 +128,7 @@ Midi_walker::do_start_note (Midi_note *note)
       midi_events_.push_back (e.val);
       e.key = stop_ticks;
       stop_note_queue.insert (e);
+      pending = e;
 
       output_event (now_ticks, note);
     }
@@ -146,10 +140,12 @@ Midi_walker::do_stop_notes (int max_ticks)
   while (stop_note_queue.size () && stop_note_queue.front ().key <= max_ticks)
     {
       Midi_note_event e = stop_note_queue.get ();
-      if (e.ignore_)
+      Midi_note_event &pending = pending_note (e.val->get_semitone_pitch ());
+      if (e.val != pending.val || e.key != pending.key)
         {
           continue;
         }
+      pending.val = 0;
 
       int stop_ticks = e.key;
       Midi_note *note = e.val;
@@ -209,6 +205,15 @@ Midi_walker::get_midi (Audio_item *i)
   return mi;
 }
 
+Midi_note_event &
+Midi_walker::pending_note (int pitch)
+{
+  int key = pitch + Midi_note::c0_pitch_;
+  if (key >= 0 && key < int (pending_notes_.size ()))
+    return pending_notes_[key];
+  return pending_notes_out_of_range_[pitch];
+}
+
 bool
 Midi_walker::ok () const
 {
@@ -117,9 +117,14 @@ Optimal_page_breaking::solve ()
   else
     message (_f ("Fitting music on %d or %d pages...", (int)page_count - 1, (int)page_count));
 
+  /* With breaking-algorithm = #'linear, the ideal line breaking is
+     kept: trying other numbers of systems would fill out the whole
+     Constrained_breaking table after all. */
+  bool ideal_only = linear_line_breaking ();
+
   /* try a smaller number of systems than the ideal number for line breaking */
   Line_division bound = ideal_line_division;
-  for (vsize sys_count = ideal_sys_count + 1; --sys_count >= min_sys_count;)
+  for (vsize sys_count = ideal_sys_count + 1; !ideal_only && --sys_count >= min_sys_count;)
     {
       Page_spacing_result best_for_this_sys_count;
       set_current_breakpoints (0, end, sys_count, Line_division (), bound);
@@ -131,6 +136,15 @@ Optimal_page_breaking::solve ()
         {
           Page_spacing_result cur;
 
+          /* A configuration that cannot beat the best one for this
+             system count need not be spaced at all. */
+          if (demerits_lower_bound (i) >= best_for_this_sys_count.demerits_)
+            {
+              if (debug_page_breaking_scoring)
+                message (_f ("skipping configuration %d", (int)i));
+              continue;
+            }
+
           if (scm_is_integer (forced_page_count))
             cur = space_systems_on_n_pages (i, page_count, first_page_num);
           else
@@ -172,7 +186,7 @@ Optimal_page_breaking::solve ()
   /* try a larger number of systems than the ideal line breaking number. This
      is more or less C&P. */
   bound = ideal_line_division;
-  for (vsize sys_count = ideal_sys_count + 1; sys_count <= max_sys_count; sys_count++)
+  for (vsize sys_count = ideal_sys_count + 1; !ideal_only && sys_count <= max_sys_count; sys_count++)
     {
       Real best_demerits_for_this_sys_count = infinity_f;
       set_current_breakpoints (0, end, sys_count, bound);
@@ -183,9 +197,12 @@ Optimal_page_breaking::solve ()
       for (vsize i = 0; i < current_configuration_count (); i++)
         {
           vsize min_p_count = min_page_count (i, first_page_num);
+          Real lower_bound = demerits_lower_bound (i);
           Page_spacing_result cur;
 
-          if (min_p_count > page_count)
+          if (min_p_count > page_count
+              || (lower_bound >= best_demerits_for_this_sys_count
+                  && lower_bound >= best.demerits_))
             continue;
           else if (scm_is_integer (forced_page_count))
             cur = space_systems_on_n_pages (i, page_count, first_page_num);
@@ -245,6 +245,10 @@ Page_breaking::Page_breaking (Paper_book *pb, Break_predicate is_break, Prob_bre
 {
   book_ = pb;
   system_count_ = 0;
+  cached_configuration_index_ = VPOS;
+  cached_spacer_ = 0;
+  cached_min_page_count_ = 0;
+  page_cache_ = scm_gc_protect_object (scm_c_make_hash_table (31));
   paper_height_ = robust_scm2double (pb->paper_->c_variable ("paper-height"), 1.0);
   ragged_ = to_boolean (pb->paper_->c_variable ("ragged-bottom"));
   ragged_last_ = to_boolean (pb->paper_->c_variable ("ragged-last-bottom"));
@@ -288,6 +292,8 @@ Page_breaking::Page_breaking (Paper_book *pb, Break_predicate is_break, Prob_bre
 
 Page_breaking::~Page_breaking ()
 {
+  delete cached_spacer_;
+  scm_gc_unprotect_object (page_cache_);
 }
 
 bool
@@ -485,6 +491,49 @@ Page_breaking::make_page (int page_num, bool last) const
                                   SCM_UNDEFINED));
 }
 
+/* Measuring the printable height of a page during scoring builds the
+   whole page, including its header and footer stencils, and make_pages
+   used to build every page twice more.  The pages are therefore kept
+   and handed to make_pages.  The paper variables that the breakers
+   change before drawing are part of the key, so that a changed first
+   page number or paper size builds fresh pages. */
+SCM
+Page_breaking::page_cache_key (int page_num, bool last) const
+{
+  static char const *variables[] = {"first-page-number", "paper-height", "paper-width"};
+
+  SCM key = scm_list_2 (scm_from_int (page_num), scm_from_bool (last));
+  for (vsize i = 0; i < sizeof (variables) / sizeof (*variables); i++)
+    {
+      SCM val = book_->paper_->c_variable (variables[i]);
+      key = scm_cons (SCM_UNBNDP (val) ? SCM_BOOL_F : val, key);
+    }
+  return key;
+}
+
+SCM
+Page_breaking::cached_page (int page_num, bool last) const
+{
+  SCM key = page_cache_key (page_num, last);
+  SCM page = scm_hash_ref (page_cache_, key, SCM_BOOL_F);
+  if (scm_is_false (page))
+    {
+      page = make_page (page_num, last);
+      scm_hash_set_x (page_cache_, key, page);
+    }
+  return page;
+}
+
+/* Like cached_page (), but the page is removed from the cache, since
+   the caller is going to fill it in. */
+SCM
+Page_breaking::take_cached_page (int page_num, bool last)
+{
+  SCM page = cached_page (page_num, last);
+  scm_hash_remove_x (page_cache_, page_cache_key (page_num, last));
+  return page;
+}
+
 // Returns the total height of the paper, including margins and
 // space for the header/footer.  This is an upper bound on
 // page_height, and it doesn't depend on the current page.
@@ -509,7 +558,7 @@ Page_breaking::page_height (int page_num, bool last) const
   else
     {
       SCM mod = scm_c_resolve_module ("scm page");
-      SCM page = make_page (page_num, last);
+      SCM page = cached_page (page_num, last);
       SCM calc_height = scm_c_module_lookup (mod, "calc-printable-height");
       calc_height = scm_variable_ref (calc_height);
 
@@ -541,7 +590,7 @@ Page_breaking::breakpoint_property (vsize breakpoint, char const *str)
 SCM
 Page_breaking::get_page_configuration (SCM systems, int page_num, bool ragged, bool last)
 {
-  SCM dummy_page = make_page (page_num, last);
+  SCM dummy_page = cached_page (page_num, last);
   Page_layout_problem layout (book_, dummy_page, systems);
   return scm_is_pair (systems) ? layout.solution (ragged) : SCM_EOL;
 }
@@ -565,7 +614,7 @@ Page_breaking::draw_page (SCM systems, SCM configuration, int page_num, bool las
   paper_systems = scm_reverse_x (paper_systems, SCM_EOL);
 
   // Create the page and draw it.
-  SCM page = make_page (page_num, last);
+  SCM page = take_cached_page (page_num, last);
 
   Prob *p = unsmob<Prob> (page);
   p->set_property ("lines", paper_systems);
@@ -620,7 +669,7 @@ Page_breaking::make_pages (vector<vsize> lines_per_page, SCM systems)
       Page_layout_problem::add_footnotes_to_lines (lines, reset_footnotes_on_new_page ? 0 : footnote_count, book_);
 
       SCM config = SCM_EOL;
-      SCM dummy_page = make_page (page_num, bookpart_last_page);
+      SCM dummy_page = cached_page (page_num, bookpart_last_page);
       Page_layout_problem layout (book_, dummy_page, lines);
       if (!scm_is_pair (systems))
         config = SCM_EOL;
@@ -912,7 +961,9 @@ Page_breaking::set_current_breakpoints (vsize start,
      5 is somewhat arbitrary. */
   if (current_configurations_.size () > 5)
     {
-      vector<pair<Real, vsize> > dems_and_indices;
+      /* Only the line details of the best 5 configurations so far are
+         kept; the others are dropped as soon as they fall out. */
+      vector<pair<Real, vsize> > best_5;
 
       for (vsize i = 0; i < current_configurations_.size (); i++)
         {
@@ -922,16 +973,45 @@ Page_breaking::set_current_breakpoints (vsize start,
             dem += cached_line_details_[j].force_ * cached_line_details_[j].force_
                    + cached_line_details_[j].break_penalty_;
 
-          dems_and_indices.push_back (pair<Real, vsize> (dem, i));
+          pair<Real, vsize> cur (dem, i);
+          best_5.insert (std::upper_bound (best_5.begin (), best_5.end (), cur), cur);
+          if (best_5.size () > 5)
+            {
+              vsize out = best_5.back ().second;
+              best_5.pop_back ();
+              if (out == i)
+                {
+                  vector<Line_details> ().swap (cached_line_details_);
+                  vector<Line_details> ().swap (uncompressed_line_details_);
+                }
+              else
+                {
+                  vector<Line_details> ().swap (line_details_store_[out]);
+                  vector<Line_details> ().swap (uncompressed_line_details_store_[out]);
+                }
+            }
         }
-      vector_sort (dems_and_indices, less<pair<Real, vsize> > ());
 
+      /* The surviving configurations are renumbered along with their
+         line details. */
+      stash_line_details ();
       vector<Line_division> best_5_configurations;
-      for (vsize i = 0; i < 5; i++)
-        best_5_configurations.push_back (current_configurations_[dems_and_indices[i].second]);
+      vector<vector<Line_details> > best_5_details;
+      vector<vector<Line_details> > best_5_uncompressed_details;
+      for (vsize i = 0; i < best_5.size (); i++)
+        {
+          vsize idx = best_5[i].second;
+          best_5_configurations.push_back (current_configurations_[idx]);
+          best_5_details.push_back (vector<Line_details> ());
+          best_5_details.back ().swap (line_details_store_[idx]);
+          best_5_uncompressed_details.push_back (vector<Line_details> ());
+          best_5_uncompressed_details.back ().swap (uncompressed_line_details_store_[idx]);
+        }
 
       clear_line_details_cache ();
       current_configurations_ = best_5_configurations;
+      line_details_store_.swap (best_5_details);
+      uncompressed_line_details_store_.swap (best_5_uncompressed_details);
     }
 }
 
@@ -965,6 +1045,21 @@ Page_breaking::set_to_ideal_line_configuration (vsize start, vsize end)
   current_configurations_.push_back (div);
 }
 
+/* Whether every score uses breaking-algorithm = #'linear. */
+bool
+Page_breaking::linear_line_breaking () const
+{
+  bool found = false;
+  for (vsize sys = 0; sys < system_specs_.size (); sys++)
+    if (system_specs_[sys].pscore_)
+      {
+        if (!line_breaking_[sys].linear_breaking ())
+          return false;
+        found = true;
+      }
+  return found;
+}
+
 vsize
 Page_breaking::current_configuration_count () const
 {
@@ -976,7 +1071,11 @@ Page_breaking::cache_line_details (vsize configuration_index)
 {
   if (cached_configuration_index_ != configuration_index)
     {
+      stash_line_details ();
       cached_configuration_index_ = configuration_index;
+      clear_spacing_cache ();
+      if (restore_line_details (configuration_index))
+        return;
 
       Line_division &div = current_configurations_[configuration_index];
       uncompressed_line_details_.clear ();
@@ -1011,6 +1110,63 @@ Page_breaking::clear_line_details_cache ()
   cached_configuration_index_ = VPOS;
   cached_line_details_.clear ();
   uncompressed_line_details_.clear ();
+  line_details_store_.clear ();
+  uncompressed_line_details_store_.clear ();
+  clear_spacing_cache ();
+}
+
+/* Move the details of the cached configuration into the store. */
+void
+Page_breaking::stash_line_details ()
+{
+  if (cached_configuration_index_ == VPOS)
+    return;
+
+  if (line_details_store_.size () < current_configurations_.size ())
+    {
+      line_details_store_.resize (current_configurations_.size ());
+      uncompressed_line_details_store_.resize (current_configurations_.size ());
+    }
+  line_details_store_[cached_configuration_index_].swap (cached_line_details_);
+  uncompressed_line_details_store_[cached_configuration_index_].swap (uncompressed_line_details_);
+  cached_line_details_.clear ();
+  uncompressed_line_details_.clear ();
+  cached_configuration_index_ = VPOS;
+}
+
+/* Move previously computed details for CONFIGURATION_INDEX out of the
+   store.  Returns false if there were none. */
+bool
+Page_breaking::restore_line_details (vsize configuration_index)
+{
+  if (configuration_index >= line_details_store_.size ()
+      || uncompressed_line_details_store_[configuration_index].empty ())
+    return false;
+
+  cached_line_details_.swap (line_details_store_[configuration_index]);
+  uncompressed_line_details_.swap (uncompressed_line_details_store_[configuration_index]);
+  return true;
+}
+
+void
+Page_breaking::clear_spacing_cache ()
+{
+  delete cached_spacer_;
+  cached_spacer_ = 0;
+  cached_min_page_count_ = 0;
+}
+
+Page_spacer &
+Page_breaking::cached_spacer (vsize configuration, vsize first_page_num)
+{
+  cache_line_details (configuration);
+  if (!cached_spacer_ || cached_spacer_first_page_num_ != first_page_num)
+    {
+      delete cached_spacer_;
+      cached_spacer_ = new Page_spacer (cached_line_details_, first_page_num, this);
+      cached_spacer_first_page_num_ = first_page_num;
+    }
+  return *cached_spacer_;
 }
 
 void
@@ -1110,6 +1266,9 @@ Page_breaking::min_page_count (vsize configuration, vsize first_page_num)
   int line_count = 0;
 
   cache_line_details (configuration);
+  if (cached_min_page_count_
+      && cached_min_page_count_first_page_num_ == first_page_num)
+    return cached_min_page_count_;
 
   if (cached_line_details_.size ())
     cur_page_height -= min_whitespace_at_top_of_page (cached_line_details_[0]);
@@ -1180,9 +1339,78 @@ Page_breaking::min_page_count (vsize configuration, vsize first_page_num)
       assert (ret <= cached_line_details_.size ());
     }
 
+  cached_min_page_count_ = ret;
+  cached_min_page_count_first_page_num_ = first_page_num;
   return ret;
 }
 
+/*
+  No spacing of CONFIGURATION can have fewer demerits than this.  The
+  line demerits are fixed before any page is spaced, and page forces
+  only add to them.  The page penalties are the only part of the page
+  demerits that may be negative; the spacing functions count the
+  penalties of each break at most twice (once for the page it ends and
+  once for the last page), so we subtract twice their magnitude.
+*/
+Real
+Page_breaking::demerits_lower_bound (vsize configuration)
+{
+  cache_line_details (configuration);
+
+  Real line_demerits = 0;
+  for (vsize i = 0; i < uncompressed_line_details_.size (); i++)
+    line_demerits += uncompressed_line_details_[i].force_ * uncompressed_line_details_[i].force_
+                     + uncompressed_line_details_[i].break_penalty_;
+
+  Real page_penalties = 0;
+  for (vsize i = 0; i < cached_line_details_.size (); i++)
+    page_penalties += fabs (cached_line_details_[i].page_penalty_)
+                      + fabs (cached_line_details_[i].turn_penalty_);
+
+  Real page_weighting = robust_scm2double (book_->paper_->c_variable ("page-spacing-weight"), 10);
+  return line_demerits - 2 * page_penalties * page_weighting;
+}
+
+/* A cheap estimate of the demerits of spacing CONFIGURATION on
+   min_page_count () pages, without running the page spacer: the
+   heights and springs of all the systems are pooled and the leftover
+   space is shared out so that every page gets the same force. */
+Real
+Page_breaking::estimated_demerits (vsize configuration, vsize first_page_num)
+{
+  vsize page_count = min_page_count (configuration, first_page_num);
+  cache_line_details (configuration);
+
+  Real line_demerits = 0;
+  for (vsize i = 0; i < uncompressed_line_details_.size (); i++)
+    line_demerits += uncompressed_line_details_[i].force_ * uncompressed_line_details_[i].force_
+                     + uncompressed_line_details_[i].break_penalty_;
+
+  Real rod_height = 0;
+  Real spring_len = 0;
+  Real inverse_hooke = 0;
+  for (vsize i = 0; i < cached_line_details_.size (); i++)
+    {
+      rod_height += cached_line_details_[i].tallness_;
+      spring_len += cached_line_details_[i].space_;
+      inverse_hooke += cached_line_details_[i].inverse_hooke_;
+    }
+
+  Real space = 0;
+  for (vsize p = 0; p < page_count; p++)
+    space += page_height (int (first_page_num + p), is_last () && p + 1 == page_count);
+
+  /* Only the pages whose force counts in finalize_spacing_result. */
+  vsize scored_pages = ragged () ? 1 : page_count;
+  if (is_last () && ragged_last () && scored_pages)
+    scored_pages--;
+
+  Real force = inverse_hooke > 0 ? (space - rod_height - spring_len) / inverse_hooke : 0;
+  Real page_demerits = scored_pages * min (force * force, BAD_SPACING_PENALTY);
+  Real page_weighting = robust_scm2double (book_->paper_->c_variable ("page-spacing-weight"), 10);
+  return line_demerits + page_demerits * page_weighting;
+}
+
 // If systems_per_page_ is positive, we don't really try to space on N pages;
 // we just put the requested number of systems on each page and penalize
 // if the result doesn't have N pages.
@@ -1212,10 +1440,7 @@ Page_breaking::space_systems_on_n_pages (vsize configuration, vsize n, vsize fir
   else if (n == 2 && valid_n)
     ret = space_systems_on_2_pages (configuration, first_page_num);
   else
-    {
-      Page_spacer ps (cached_line_details_, first_page_num, this);
-      ret = ps.solve (n);
-    }
+    ret = cached_spacer (configuration, first_page_num).solve (n);
 
   return finalize_spacing_result (configuration, ret);
 }
@@ -1274,7 +1499,7 @@ Page_breaking::space_systems_on_n_or_one_more_pages (vsize configuration, vsize
     }
   else
     {
-      Page_spacer ps (cached_line_details_, first_page_num, this);
+      Page_spacer &ps = cached_spacer (configuration, first_page_num);
 
       if (n >= min_p_count || !valid_n)
         n_res = ps.solve (n);
@@ -1300,10 +1525,8 @@ Page_breaking::space_systems_on_best_pages (vsize configuration, vsize first_pag
   if (systems_per_page_ > 0)
     return space_systems_with_fixed_number_per_page (configuration, first_page_num);
 
-  cache_line_details (configuration);
-  Page_spacer ps (cached_line_details_, first_page_num, this);
-
-  return finalize_spacing_result (configuration, ps.solve ());
+  return finalize_spacing_result (configuration,
+                                 cached_spacer (configuration, first_page_num).solve ());
 }
 
 Page_spacing_result
@@ -126,6 +126,74 @@ Page_turn_page_breaking::total_page_count (Break_node const &b)
 
 extern bool debug_page_breaking_scoring;
 
+/* The number of the first page after a page turn at START - 1. */
+int
+Page_turn_page_breaking::start_page_number (vsize start) const
+{
+  int p_num = robust_scm2int (book_->paper_->c_variable ("first-page-number"), 1);
+  if (start > 0)
+    {
+      /* except possibly for the first page, enforce the fact that first_page_number_
+         should always be even (left hand page).
+         TODO: are there different conventions in right-to-left languages?
+      */
+      p_num = state_[start - 1].first_page_number_ + state_[start - 1].page_count_;
+      p_num += p_num % 2;
+    }
+  return p_num;
+}
+
+/* The starting breakpoints that calc_subproblem should space exactly,
+   in decreasing order.  With COUNT == 0, these are all of them.
+   Otherwise every start is scored with estimated_demerits () on its
+   ideal line configuration and only the COUNT best survive; the
+   start right before END is always kept so that there is at least
+   one solution. */
+vector<vsize>
+Page_turn_page_breaking::candidate_starts (vsize end, vsize count)
+{
+  vector<vsize> ret;
+  if (!count)
+    {
+      for (vsize start = end; start--;)
+        ret.push_back (start);
+      return ret;
+    }
+
+  vector<pair<Real, vsize> > estimates;
+  for (vsize start = end; start--;)
+    {
+      if (start < end - 1
+          && scm_is_eq (breakpoint_property (start + 1, "page-turn-permission"),
+                        ly_symbol2scm ("force")))
+        break;
+
+      int p_num = start_page_number (start);
+      set_to_ideal_line_configuration (start, end);
+      vsize min_p_count = min_page_count (0, p_num);
+
+      /* Further starts only get longer.  The ideal configuration is not
+         always the shortest, so allow one page of slack before giving
+         up. */
+      if (start < end - 1 && min_p_count + (p_num % 2) > 3)
+        break;
+
+      Real dem = estimated_demerits (0, p_num);
+      if (start > 0)
+        dem += state_[start - 1].demerits_;
+      estimates.push_back (pair<Real, vsize> (dem, start));
+    }
+  vector_sort (estimates, less<pair<Real, vsize> > ());
+
+  ret.push_back (end - 1);
+  for (vsize i = 0; i < estimates.size () && ret.size () < count; i++)
+    if (estimates[i].second != end - 1)
+      ret.push_back (estimates[i].second);
+
+  vector_sort (ret, greater<vsize> ());
+  return ret;
+}
+
 void
 Page_turn_page_breaking::calc_subproblem (vsize ending_breakpoint)
 {
@@ -135,8 +203,12 @@ Page_turn_page_breaking::calc_subproblem (vsize ending_breakpoint)
   Break_node this_start_best;
   vsize prev_best_system_count = 0;
 
-  for (vsize start = end; start--;)
+  int candidate_count = robust_scm2int (book_->paper_->c_variable ("page-turn-candidate-count"), 0);
+  vector<vsize> starts = candidate_starts (end, max (candidate_count, 0));
+
+  for (vsize s = 0; s < starts.size (); s++)
     {
+      vsize start = starts[s];
       if (start < end - 1
           && scm_is_eq (breakpoint_property (start + 1, "page-turn-permission"),
                         ly_symbol2scm ("force")))
@@ -145,16 +217,7 @@ Page_turn_page_breaking::calc_subproblem (vsize ending_breakpoint)
       if (start > 0 && best.demerits_ < state_[start - 1].demerits_)
         continue;
 
-      int p_num = robust_scm2int (book_->paper_->c_variable ("first-page-number"), 1);
-      if (start > 0)
-        {
-          /* except possibly for the first page, enforce the fact that first_page_number_
-             should always be even (left hand page).
-             TODO: are there different conventions in right-to-left languages?
-          */
-          p_num = state_[start - 1].first_page_number_ + state_[start - 1].page_count_;
-          p_num += p_num % 2;
-        }
+      int p_num = start_page_number (start);
 
       Line_division min_division;
       Line_division max_division;
@@ -246,6 +309,9 @@ Page_turn_page_breaking::solve ()
     }
   reverse (breaking);
 
+  if (debug_page_breaking_scoring && !breaking.empty ())
+    message (_f ("page-turn-page-breaking: total demerits %f", breaking.back ().demerits_));
+
   message (_ ("Drawing systems..."));
   SCM systems = make_lines (&breaking);
   return make_pages (breaking, systems);
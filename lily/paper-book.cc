@@ -242,6 +242,8 @@ Paper_book::classic_output (SCM output)
 {
   long first_performance_number = 0;
   classic_output_aux (output, &first_performance_number);
+  if (get_program_option ("midi-only"))
+    return;
 
   SCM scopes = SCM_EOL;
   if (ly_is_module (header_))
@@ -19,7 +19,15 @@
 
 #include "performance.hh"
 
+#include "config.hh"
+
 #include <ctime>
+#if HAVE_FORK
+#include <cerrno>
+#include <cstdio>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
 #include "audio-column.hh"
@@ -31,6 +39,7 @@ using namespace std;
 #include "main.hh"
 #include "midi-chunk.hh"
 #include "midi-stream.hh"
+#include "program-option.hh"
 #include "score.hh"
 #include "string-convert.hh"
 #include "warn.hh"
@@ -72,6 +81,13 @@ Performance::output (Midi_stream &midi_stream,
 {
   int tracks_ = audio_staffs_.size ();
 
+  /* Most events take four bytes or less, and each note needs two;
+     reserve enough for the whole file up front.  */
+  vsize size = 14;
+  for (vsize i = 0; i < audio_staffs_.size (); i++)
+    size += 17 + 8 * audio_staffs_[i]->audio_items_.size ();
+  midi_stream.reserve (size);
+
   midi_stream.write (Midi_header (1, tracks_, 384));
   debug_output (_ ("Track...") + " ", false);
 
@@ -100,10 +116,253 @@ Performance::output (Midi_stream &midi_stream,
           assert (text->text_string_ == "control track");
           text->text_string_ = performance_name;
         }
-      debug_output ("[" + ::to_string (i), true);
-      s->output (midi_stream, i, ports_, moment_to_ticks (start_mom));
-      debug_output ("]", false);
     }
+
+  int start_tick = moment_to_ticks (start_mom);
+  int jobs = robust_scm2int (ly_get_option (ly_symbol2scm ("midi-job-count")), 1);
+  if (jobs > tracks_)
+    jobs = tracks_;
+
+  if (jobs > 1)
+    {
+      vector<string> tracks (audio_staffs_.size ());
+      vector<vector<Held_message> > messages (audio_staffs_.size ());
+      output_tracks_forked (jobs, start_tick, &tracks, &messages);
+      for (vsize i = 0; i < tracks.size (); i++)
+        {
+          debug_output ("[" + ::to_string (i), true);
+          if (tracks[i].empty ())
+            output_track (i, start_tick, &tracks[i]);
+          else
+            report_held_messages (messages[i]);
+          midi_stream.write (tracks[i]);
+          debug_output ("]", false);
+        }
+
+      if (to_boolean (ly_get_option (ly_symbol2scm ("check-midi-job-count"))))
+        for (vsize i = 0; i < tracks.size (); i++)
+          {
+            string serial;
+            vector<Held_message> ignored;
+            hold_messages (&ignored);
+            output_track (i, start_tick, &serial);
+            hold_messages (0);
+            if (serial != tracks[i])
+              warning (_f ("MIDI track %d written by -dmidi-job-count differs"
+                           " from the serial output",
+                           int (i)));
+          }
+    }
+  else
+    for (vsize i = 0; i < audio_staffs_.size (); i++)
+      {
+        debug_output ("[" + ::to_string (i), true);
+        output_track (i, start_tick, &midi_stream.buffer_);
+        debug_output ("]", false);
+      }
+}
+
+void
+Performance::output_track (vsize i, int start_tick, string *out) const
+{
+  audio_staffs_[i]->output (out, i, ports_, start_tick);
+}
+
+#if HAVE_FORK
+static bool
+write_fully (int fd, char const *data, size_t size)
+{
+  while (size)
+    {
+      ssize_t n = write (fd, data, size);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        return false;
+      data += n;
+      size -= n;
+    }
+  return true;
+}
+
+static bool
+read_fully (int fd, char *data, size_t size)
+{
+  while (size)
+    {
+      ssize_t n = read (fd, data, size);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        return false;
+      data += n;
+      size -= n;
+    }
+  return true;
+}
+
+static void
+append_int (string *out, size_t n)
+{
+  for (int shift = 24; shift >= 0; shift -= 8)
+    *out += char ((n >> shift) & 0xff);
+}
+
+static bool
+read_int (int fd, size_t *n)
+{
+  unsigned char bytes[4];
+  if (!read_fully (fd, (char *) bytes, sizeof (bytes)))
+    return false;
+  *n = 0;
+  for (vsize b = 0; b < sizeof (bytes); b++)
+    *n = (*n << 8) | bytes[b];
+  return true;
+}
+
+static bool
+read_string (int fd, string *s)
+{
+  size_t length = 0;
+  if (!read_int (fd, &length))
+    return false;
+  s->resize (length);
+  return !length || read_fully (fd, &(*s)[0], length);
+}
+
+/* The messages of a track, as the count followed by the kind, text and
+   location of each message.  */
+static void
+append_held_messages (string *out, vector<Held_message> const &held)
+{
+  append_int (out, held.size ());
+  for (vsize i = 0; i < held.size (); i++)
+    {
+      *out += char (held[i].kind_);
+      append_int (out, held[i].message_.length ());
+      *out += held[i].message_;
+      append_int (out, held[i].location_.length ());
+      *out += held[i].location_;
+    }
+}
+
+static bool
+read_held_messages (int fd, vector<Held_message> *held)
+{
+  size_t count = 0;
+  if (!read_int (fd, &count))
+    return false;
+  held->resize (count);
+  for (vsize i = 0; i < count; i++)
+    {
+      char kind;
+      if (!read_fully (fd, &kind, 1)
+          || !read_string (fd, &(*held)[i].message_)
+          || !read_string (fd, &(*held)[i].location_))
+        return false;
+      (*held)[i].kind_ = Held_message::Kind (kind);
+    }
+  return true;
+}
+#endif
+
+/*
+  Write the tracks for -dmidi-job-count: JOBS - 1 child processes each
+  write every JOBS-th track into a pipe, while this process writes its
+  own share.  The chunks are put back in track order, so the file is
+  the same as when the tracks are written one after the other.  The
+  warnings raised while writing a track are stored in MESSAGES, so
+  that they can be reported in track order as well.  Tracks that a
+  child failed to deliver are left empty.
+*/
+void
+Performance::output_tracks_forked (int jobs, int start_tick,
+                                   vector<string> *tracks,
+                                   vector<vector<Held_message> > *messages) const
+{
+#if HAVE_FORK
+  /* Otherwise buffered output is written once more by every child
+     that exits through exit ().  */
+  fflush (0);
+
+  vector<pid_t> pids;
+  vector<int> fds;
+  for (int job = 1; job < jobs; job++)
+    {
+      int fd[2];
+      if (pipe (fd))
+        break;
+
+      pid_t pid = fork ();
+      if (pid < 0)
+        {
+          close (fd[0]);
+          close (fd[1]);
+          break;
+        }
+
+      if (!pid)
+        {
+          close (fd[0]);
+          string buffer;
+          for (vsize i = job; i < tracks->size (); i += jobs)
+            {
+              vector<Held_message> held;
+              hold_messages (&held);
+              output_track (i, start_tick, &buffer);
+              hold_messages (0);
+              append_held_messages (&buffer, held);
+            }
+          _exit (write_fully (fd[1], buffer.data (), buffer.length ()) ? 0 : 1);
+        }
+
+      close (fd[1]);
+      pids.push_back (pid);
+      fds.push_back (fd[0]);
+    }
+
+  for (vsize i = 0; i < tracks->size (); i += jobs)
+    {
+      hold_messages (&(*messages)[i]);
+      output_track (i, start_tick, &(*tracks)[i]);
+      hold_messages (0);
+    }
+
+  for (vsize k = 0; k < pids.size (); k++)
+    {
+      int job = k + 1;
+      bool ok = true;
+      for (vsize i = job; ok && i < tracks->size (); i += jobs)
+        {
+          /* "MTrk" and the length of the data, see Midi_chunk::write */
+          char header[8];
+          ok = read_fully (fds[k], header, sizeof (header));
+          if (!ok)
+            break;
+
+          size_t length = 0;
+          for (int b = 4; b < 8; b++)
+            length = (length << 8) | (unsigned char) header[b];
+
+          string &track = (*tracks)[i];
+          track.assign (header, sizeof (header));
+          track.resize (sizeof (header) + length);
+          ok = read_fully (fds[k], &track[sizeof (header)], length)
+               && read_held_messages (fds[k], &(*messages)[i]);
+        }
+      close (fds[k]);
+
+      int status = 0;
+      while (waitpid (pids[k], &status, 0) < 0 && errno == EINTR)
+        ;
+      if (!ok || !WIFEXITED (status) || WEXITSTATUS (status))
+        for (vsize i = job; i < tracks->size (); i += jobs)
+          {
+            (*tracks)[i].clear ();
+            (*messages)[i].clear ();
+          }
+    }
+#endif
 }
 
 void
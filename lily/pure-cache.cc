@@ -0,0 +1,97 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2016 agent <agent@local>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "pure-cache.hh"
+
+static Pure_cache::Counter *all_counters = 0;
+
+Pure_cache::Counter::Counter (char const *name)
+{
+  name_ = name;
+  hits_ = 0;
+  misses_ = 0;
+  next_ = all_counters;
+  all_counters = this;
+}
+
+Pure_cache::Key::Key (SCM sym, int start, int end)
+{
+  sym_ = sym;
+  start_ = start;
+  end_ = end;
+}
+
+bool
+Pure_cache::Key::operator < (Key const &other) const
+{
+  if (start_ != other.start_)
+    return start_ < other.start_;
+  if (end_ != other.end_)
+    return end_ < other.end_;
+  return SCM_UNPACK (sym_) < SCM_UNPACK (other.sym_);
+}
+
+/* Return SCM_UNDEFINED if nothing is cached. */
+SCM
+Pure_cache::get (SCM sym, int start, int end, Counter *counter) const
+{
+  map<Key, SCM>::const_iterator i = values_.find (Key (sym, start, end));
+  if (i == values_.end ())
+    {
+      counter->miss ();
+      return SCM_UNDEFINED;
+    }
+  counter->hit ();
+  return i->second;
+}
+
+void
+Pure_cache::set (SCM sym, int start, int end, SCM val)
+{
+  values_[Key (sym, start, end)] = val;
+}
+
+void
+Pure_cache::gc_mark () const
+{
+  for (map<Key, SCM>::const_iterator i = values_.begin ();
+       i != values_.end (); i++)
+    scm_gc_mark (i->second);
+}
+
+SCM
+Pure_cache::statistics ()
+{
+  SCM ret = SCM_EOL;
+  for (Counter *c = all_counters; c; c = c->next_)
+    ret = scm_cons (scm_cons (ly_symbol2scm (c->name_),
+                              scm_cons (scm_from_long (c->hits_),
+                                        scm_from_long (c->misses_))),
+                    ret);
+  return ret;
+}
+
+LY_DEFINE (ly_pure_cache_statistics, "ly:pure-cache-statistics",
+           0, 0, 0, (),
+           "Return an alist of @code{(@var{name} @var{hits} ."
+           " @var{misses})} entries, one for each kind of cached"
+           " pure query.")
+{
+  return Pure_cache::statistics ();
+}
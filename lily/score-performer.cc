@@ -25,6 +25,7 @@
 #include "dispatcher.hh"
 #include "global-context.hh"
 #include "performance.hh"
+#include "midi-event-stream.hh"
 #include "midi-stream.hh"
 #include "output-def.hh"
 #include "string-convert.hh"
@@ -50,6 +51,7 @@ Score_performer::Score_performer ()
   performance_ = 0;
   skipping_ = false;
   audio_column_ = 0;
+  event_stream_ = 0;
 }
 
 Score_performer::~Score_performer ()
@@ -118,6 +120,8 @@ Score_performer::finish (SCM)
   SCM channel_mapping = context ()->get_property ("midiChannelMapping");
   bool use_ports = scm_is_eq (channel_mapping, ly_symbol2scm ("voice"));
   performance_->ports_ = use_ports;
+  if (event_stream_)
+    event_stream_->finish ();
   recurse_over_translators
     (context (),
      Callback0_wrapper::make_smob<Translator, &Translator::finalize> (),
@@ -158,6 +162,9 @@ Score_performer::one_time_step (SCM)
       audio_column_->offset_when (offset_mom_);
       precomputed_recurse_over_translators (context (), PROCESS_MUSIC, UP);
       do_announces ();
+
+      if (event_stream_)
+        event_stream_->process (audio_column_);
     }
 
   precomputed_recurse_over_translators (context (), STOP_TRANSLATION_TIMESTEP, UP);
@@ -180,5 +187,9 @@ Score_performer::initialize ()
   context ()->set_property ("output", performance_->self_scm ());
   performance_->midi_ = context ()->get_output_def ();
 
+  event_stream_ = Midi_event_stream::get ();
+  if (event_stream_)
+    event_stream_->start ();
+
   Translator_group::initialize ();
 }
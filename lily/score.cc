@@ -34,6 +34,7 @@ using namespace std;
 #include "output-def.hh"
 #include "paper-book.hh"
 #include "paper-score.hh"
+#include "program-option.hh"
 #include "warn.hh"
 
 
@@ -122,11 +123,17 @@ Score::book_rendering (Output_def *layoutbook,
 
   SCM outputs = SCM_EOL;
 
+  /* With -dmidi-only, only the performer tree is built and run.  */
+  bool midi_only = get_program_option ("midi-only");
+
   int outdef_count = defs_.size ();
 
   for (int i = 0; !i || i < outdef_count; i++)
     {
       Output_def *def = outdef_count ? defs_[i] : default_def;
+      if (midi_only && !to_boolean (def->c_variable ("is-midi")))
+        continue;
+
       SCM scaled = def->self_scm ();
 
       if (to_boolean (def->c_variable ("is-layout")))
@@ -89,7 +89,7 @@ Simple_spacer::fits () const
 }
 
 Real
-Simple_spacer::rod_force (int l, int r, Real dist)
+Simple_spacer::rod_force (int l, int r, Real dist) const
 {
   Real d = range_ideal_len (l, r);
   Real c = range_stiffness (l, r, dist > d);
@@ -404,6 +404,176 @@ get_column_description (vector<Grob *> const &cols, vsize col_index, bool line_s
   return description;
 }
 
+/*
+  Set up the spring/rod problem for the line running from column ST to
+  column END, from scratch.
+*/
+static Simple_spacer
+get_line_spacer (vector<Column_description> const &cols, vsize st, vsize end)
+{
+  Simple_spacer spacer;
+
+  for (vsize i = st; i < end - 1; i++)
+    spacer.add_spring (cols[i].spring_);
+  spacer.add_spring (cols[end - 1].end_spring_);
+
+  for (vsize i = st; i < end; i++)
+    {
+      for (vsize r = 0; r < cols[i].rods_.size (); r++)
+        if (cols[i].rods_[r].r_ < end)
+          spacer.add_rod (i - st, cols[i].rods_[r].r_ - st, cols[i].rods_[r].dist_);
+      for (vsize r = 0; r < cols[i].end_rods_.size (); r++)
+        if (cols[i].end_rods_[r].r_ == end)
+          spacer.add_rod (i - st, end - st, cols[i].end_rods_[r].dist_);
+      if (!cols[i].keep_inside_line_.is_empty ())
+        {
+          spacer.add_rod (i - st, end - st, cols[i].keep_inside_line_[RIGHT]);
+          spacer.add_rod (0, i - st, -cols[i].keep_inside_line_[LEFT]);
+        }
+    }
+  return spacer;
+}
+
+struct Pending_rod
+{
+  vsize l_;
+  vsize r_;
+  Real dist_;
+
+  Pending_rod (vsize l, vsize r, Real d)
+  {
+    l_ = l;
+    r_ = r;
+    dist_ = d;
+  }
+
+  /* heap order: the rod that becomes active first is on top */
+  bool operator < (Pending_rod const &other) const
+  {
+    return r_ > other.r_;
+  }
+};
+
+/*
+  Spring/rod problems for all lines starting at one column.
+
+  Going from one end column to a later one, only the springs and rods
+  of the added columns are new; the springs and the rods that lie
+  completely inside the shorter line stay the same.  We keep those in
+  BASE_, and only add what depends on the end column (the spring
+  towards the prebroken end column, rods to it, keep-inside-line rods)
+  to a copy.  Rods that reach beyond the current end wait in PENDING_
+  until a line is long enough to contain them.
+
+  Rods between infinitely stiff springs stretch those springs, which
+  makes the outcome depend on the order in which the rods are added.
+  In that case we build the problem from scratch, in the original
+  order.
+*/
+static bool
+stretches_springs (Simple_spacer const &spacer, int l, int r, Real dist)
+{
+  return isinf (spacer.rod_force (l, r, dist))
+         && spacer.range_ideal_len (l, r) < dist;
+}
+
+class Incremental_spacer
+{
+  vector<Column_description> const &cols_;
+  vsize start_;
+  vsize spring_end_;
+  vsize rod_end_;
+  bool rigid_;
+
+  Simple_spacer base_;
+  vector<Pending_rod> pending_;
+  vector<Pending_rod> end_rods_;
+
+  void add_base_rod (Pending_rod const &rod);
+
+public:
+  Incremental_spacer (vector<Column_description> const &cols, vsize start);
+  Simple_spacer extend_to (vsize end);
+};
+
+Incremental_spacer::Incremental_spacer (vector<Column_description> const &cols,
+                                        vsize start)
+  : cols_ (cols)
+{
+  start_ = start;
+  spring_end_ = start;
+  rod_end_ = start;
+  rigid_ = false;
+}
+
+void
+Incremental_spacer::add_base_rod (Pending_rod const &rod)
+{
+  int l = int (rod.l_ - start_);
+  int r = int (rod.r_ - start_);
+  if (stretches_springs (base_, l, r, rod.dist_))
+    rigid_ = true;
+  base_.add_rod (l, r, rod.dist_);
+}
+
+/*
+  Return the spring/rod problem for the line from the start column to
+  column END.  END must not decrease between calls.
+*/
+Simple_spacer
+Incremental_spacer::extend_to (vsize end)
+{
+  for (; spring_end_ + 1 < end; spring_end_++)
+    base_.add_spring (cols_[spring_end_].spring_);
+
+  for (; rod_end_ < end; rod_end_++)
+    {
+      Column_description const &col = cols_[rod_end_];
+      for (vsize r = 0; r < col.rods_.size (); r++)
+        {
+          pending_.push_back (Pending_rod (rod_end_, col.rods_[r].r_, col.rods_[r].dist_));
+          push_heap (pending_.begin (), pending_.end ());
+        }
+      for (vsize r = 0; r < col.end_rods_.size (); r++)
+        end_rods_.push_back (Pending_rod (rod_end_, col.end_rods_[r].r_, col.end_rods_[r].dist_));
+      if (!col.keep_inside_line_.is_empty ())
+        add_base_rod (Pending_rod (start_, rod_end_, -col.keep_inside_line_[LEFT]));
+    }
+
+  while (!pending_.empty () && pending_.front ().r_ < end)
+    {
+      pop_heap (pending_.begin (), pending_.end ());
+      add_base_rod (pending_.back ());
+      pending_.pop_back ();
+    }
+
+  if (rigid_)
+    return get_line_spacer (cols_, start_, end);
+
+  Simple_spacer spacer (base_);
+  spacer.add_spring (cols_[end - 1].end_spring_);
+
+  int line_end = int (end - start_);
+  for (vsize i = 0; i < end_rods_.size (); i++)
+    if (end_rods_[i].r_ == end)
+      {
+        int l = int (end_rods_[i].l_ - start_);
+        if (stretches_springs (spacer, l, line_end, end_rods_[i].dist_))
+          return get_line_spacer (cols_, start_, end);
+        spacer.add_rod (l, line_end, end_rods_[i].dist_);
+      }
+  for (vsize i = start_; i < end; i++)
+    if (!cols_[i].keep_inside_line_.is_empty ())
+      {
+        int l = int (i - start_);
+        if (stretches_springs (spacer, l, line_end, cols_[i].keep_inside_line_[RIGHT]))
+          return get_line_spacer (cols_, start_, end);
+        spacer.add_rod (l, line_end, cols_[i].keep_inside_line_[RIGHT]);
+      }
+
+  return spacer;
+}
+
 vector<Real>
 get_line_forces (vector<Grob *> const &columns,
                  Real line_len, Real indent, bool ragged)
@@ -434,31 +604,12 @@ get_line_forces (vector<Grob *> const &columns,
   for (vsize b = 0; b + 1 < breaks.size (); b++)
     {
       cols[breaks[b]] = get_column_description (non_loose, breaks[b], true);
-      vsize st = breaks[b];
+      Incremental_spacer lines (cols, breaks[b]);
 
       for (vsize c = b + 1; c < breaks.size (); c++)
         {
           vsize end = breaks[c];
-          Simple_spacer spacer;
-
-          for (vsize i = breaks[b]; i < end - 1; i++)
-            spacer.add_spring (cols[i].spring_);
-          spacer.add_spring (cols[end - 1].end_spring_);
-
-          for (vsize i = breaks[b]; i < end; i++)
-            {
-              for (vsize r = 0; r < cols[i].rods_.size (); r++)
-                if (cols[i].rods_[r].r_ < end)
-                  spacer.add_rod (i - st, cols[i].rods_[r].r_ - st, cols[i].rods_[r].dist_);
-              for (vsize r = 0; r < cols[i].end_rods_.size (); r++)
-                if (cols[i].end_rods_[r].r_ == end)
-                  spacer.add_rod (i - st, end - st, cols[i].end_rods_[r].dist_);
-              if (!cols[i].keep_inside_line_.is_empty ())
-                {
-                  spacer.add_rod (i - st, end - st, cols[i].keep_inside_line_[RIGHT]);
-                  spacer.add_rod (0, i - st, -cols[i].keep_inside_line_[LEFT]);
-                }
-            }
+          Simple_spacer spacer = lines.extend_to (end);
           spacer.solve ((b == 0) ? line_len - indent : line_len, ragged);
           force[b * breaks.size () + c] = spacer.force_penalty (ragged);
 
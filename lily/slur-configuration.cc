@@ -19,7 +19,6 @@
 
 #include "slur-configuration.hh"
 
-#include "item.hh"
 #include "libc-extension.hh"
 #include "misc.hh"
 #include "pointer-group-interface.hh"
@@ -27,8 +26,6 @@
 #include "slur.hh"
 #include "spanner.hh"
 #include "staff-symbol-referencer.hh"
-#include "stem.hh"
-#include "tie.hh"
 #include "warn.hh"
 
 Bezier
@@ -221,27 +218,42 @@ Slur_configuration::add_score (Real s, const string &desc)
 void
 Slur_configuration::score_encompass (Slur_score_state const &state)
 {
-  Bezier const &bez (curve_);
   Real demerit = 0.0;
 
+  /*
+    Evaluate the curve at all encompassed columns in one go.
+  */
+  vector<vsize> inside;
+  vector<Real> xs;
+  for (vsize j = 0; j < state.encompass_infos_.size (); j++)
+    {
+      Real x = state.encompass_infos_[j].x_;
+      if (x < attachment_[RIGHT][X_AXIS]
+          && x > attachment_[LEFT][X_AXIS])
+        {
+          inside.push_back (j);
+          xs.push_back (x);
+        }
+    }
+
+  vector<Real> ys;
+  curve_.get_other_coordinate (X_AXIS, xs, &ys);
+
   /*
     Distances for heads that are between slur and line between
     attachment points.
   */
   vector<Real> convex_head_distances;
-  for (vsize j = 0; j < state.encompass_infos_.size (); j++)
+  for (vsize k = 0; k < inside.size (); k++)
     {
-      Real x = state.encompass_infos_[j].x_;
+      vsize j = inside[k];
+      Real x = xs[k];
+      Real y = ys[k];
 
       bool l_edge = j == 0;
       bool r_edge = j == state.encompass_infos_.size () - 1;
       bool edge = l_edge || r_edge;
 
-      if (! (x < attachment_[RIGHT][X_AXIS]
-             && x > attachment_[LEFT][X_AXIS]))
-        continue;
-
-      Real y = bez.get_other_coordinate (X_AXIS, x);
       if (!edge)
         {
           Real head_dy = (y - state.encompass_infos_[j].head_);
@@ -331,27 +343,7 @@ Slur_configuration::score_encompass (Slur_score_state const &state)
 void
 Slur_configuration::score_extra_encompass (Slur_score_state const &state)
 {
-  // we find forbidden attachments
-  vector<Offset> forbidden_attachments;
-  for (vsize i = 0; i < state.extra_encompass_infos_.size (); i++)
-    if (has_interface<Tie> (state.extra_encompass_infos_[i].grob_))
-      {
-        Grob *t = state.extra_encompass_infos_[i].grob_;
-        Grob *common_x = Grob::get_vertical_axis_group (t);
-        Real rp = t->relative_coordinate (common_x, X_AXIS);
-        SCM cp = t->get_property ("control-points");
-
-        Bezier b;
-        int j = 0;
-        for (SCM s = cp; scm_is_pair (s); s = scm_cdr (s))
-          {
-            b.control_[j] = ly_scm2offset (scm_car (s));
-            j++;
-          }
-        forbidden_attachments.push_back (Offset (b.control_[0]) + Offset (rp, 0));
-        forbidden_attachments.push_back (Offset (b.control_[3]) + Offset (rp, 0));
-      }
-
+  vector<Offset> const &forbidden_attachments = state.forbidden_attachments_;
   bool too_close = false;
   for (vsize k = 0; k < forbidden_attachments.size (); k++)
     for (LEFT_and_RIGHT (side))
@@ -364,52 +356,44 @@ Slur_configuration::score_extra_encompass (Slur_score_state const &state)
   if (too_close)
     add_score (state.parameters_.slur_tie_extrema_min_distance_penalty_, "extra");
 
+  Interval slur_wid (attachment_[LEFT][X_AXIS], attachment_[RIGHT][X_AXIS]);
+
+  /*
+    Collect the objects that need the height of the curve, and
+    evaluate it for all of them at once.  Objects that overlap a
+    bound are measured against the attachment point, to prevent
+    numerical inaccuracies in Bezier::get_other_coordinate ().
+  */
+  vector<vsize> scored;
+  vector<Real> xs;
   for (vsize j = 0; j < state.extra_encompass_infos_.size (); j++)
     {
-      Drul_array<Offset> attachment = attachment_;
       Extra_collision_info const &info (state.extra_encompass_infos_[j]);
-
-      Interval slur_wid (attachment[LEFT][X_AXIS], attachment[RIGHT][X_AXIS]);
-
-      /*
-        to prevent numerical inaccuracies in
-        Bezier::get_other_coordinate ().
-      */
-
-      bool found = false;
-      Real y = 0.0;
-
-      for (LEFT_and_RIGHT (d))
+      if (info.bound_dir_ != CENTER)
         {
-          /*
-            We need to check for the bound explicitly, since the
-            slur-ending can be almost vertical, making the Y
-            coordinate a bad approximation of the object-slur
-            distance.
-          */
-          Item *as_item = dynamic_cast<Item *> (state.extra_encompass_infos_[j].grob_);
-          if (!as_item)
-            continue;
-
-          Interval item_x = as_item->extent (state.common_[X_AXIS], X_AXIS);
-          item_x.intersect (state.extremes_[d].slur_head_x_extent_);
-          if (!item_x.is_empty ())
-            {
-              y = attachment[d][Y_AXIS];
-              found = true;
-            }
-
+          scored.push_back (j);
+          continue;
         }
 
-      if (!found)
-        {
-          Real x = info.extents_[X_AXIS].linear_combination (info.idx_);
+      Real x = info.extents_[X_AXIS].linear_combination (info.idx_);
+      if (!slur_wid.contains (x))
+        continue;
+
+      scored.push_back (j);
+      xs.push_back (x);
+    }
 
-          if (!slur_wid.contains (x))
-            continue;
+  vector<Real> curve_ys;
+  curve_.get_other_coordinate (X_AXIS, xs, &curve_ys);
 
-          y = curve_.get_other_coordinate (X_AXIS, x);
-        }
+  vsize next_curve_y = 0;
+  for (vsize k = 0; k < scored.size (); k++)
+    {
+      Extra_collision_info const &info (state.extra_encompass_infos_[scored[k]]);
+
+      Real y = (info.bound_dir_ != CENTER)
+               ? attachment_[info.bound_dir_][Y_AXIS]
+               : curve_ys[next_curve_y++];
 
       Real dist = 0.0;
       if (scm_is_eq (info.type_, ly_symbol2scm ("around")))
@@ -450,8 +434,7 @@ Slur_configuration::score_edges (Slur_score_state const &state)
       Real demerit = factor * dy;
       if (state.extremes_[d].stem_
           && state.extremes_[d].stem_dir_ == state.dir_
-          // TODO - Stem::get_beaming() should be precomputed.
-          && !Stem::get_beaming (state.extremes_[d].stem_, -d))
+          && !state.extremes_[d].inner_beam_count_)
         demerit /= 5;
 
       demerit *= exp (state.dir_ * d * slope
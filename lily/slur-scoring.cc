@@ -43,6 +43,7 @@
 #include "staff-symbol-referencer.hh"
 #include "staff-symbol.hh"
 #include "stem.hh"
+#include "tie.hh"
 #include "warn.hh"
 
 /*
@@ -199,6 +200,8 @@ Slur_score_state::get_bound_info () const
                                    ::get_staff_symbol (extremes[d].stem_);
               extremes[d].staff_space_ = Staff_symbol_referencer
                                          ::staff_space (extremes[d].stem_);
+              extremes[d].inner_beam_count_
+                = Stem::get_beaming (extremes[d].stem_, -d);
             }
 
         }
@@ -271,6 +274,7 @@ Slur_score_state::fill (Grob *me)
     = get_y_attachment_range ();
 
   extra_encompass_infos_ = get_extra_encompass_infos ();
+  forbidden_attachments_ = get_forbidden_attachments ();
 
   Interval additional_ys (0.0, 0.0);
 
@@ -845,6 +849,22 @@ Slur_score_state::get_extra_encompass_infos () const
           ye.widen (thickness_ * 0.5);
           xe.widen (thickness_ * 1.0);
           Extra_collision_info info (g, xp, xe, ye, penalty);
+
+          /*
+            We need to check for the bound explicitly, since the
+            slur-ending can be almost vertical, making the Y
+            coordinate a bad approximation of the object-slur
+            distance.
+          */
+          if (dynamic_cast<Item *> (g))
+            for (LEFT_and_RIGHT (d))
+              {
+                Interval item_x = g->extent (common_[X_AXIS], X_AXIS);
+                item_x.intersect (extremes_[d].slur_head_x_extent_);
+                if (!item_x.is_empty ())
+                  info.bound_dir_ = d;
+              }
+
           collision_infos.push_back (info);
         }
     }
@@ -852,6 +872,36 @@ Slur_score_state::get_extra_encompass_infos () const
   return collision_infos;
 }
 
+/*
+  Attachment points of ties among the encompass objects: slur ends
+  should keep their distance from these.
+*/
+vector<Offset>
+Slur_score_state::get_forbidden_attachments () const
+{
+  vector<Offset> forbidden_attachments;
+  for (vsize i = 0; i < extra_encompass_infos_.size (); i++)
+    if (has_interface<Tie> (extra_encompass_infos_[i].grob_))
+      {
+        Grob *t = extra_encompass_infos_[i].grob_;
+        Grob *common_x = Grob::get_vertical_axis_group (t);
+        Real rp = t->relative_coordinate (common_x, X_AXIS);
+        SCM cp = t->get_property ("control-points");
+
+        Bezier b;
+        int j = 0;
+        for (SCM s = cp; scm_is_pair (s); s = scm_cdr (s))
+          {
+            b.control_[j] = ly_scm2offset (scm_car (s));
+            j++;
+          }
+        forbidden_attachments.push_back (Offset (b.control_[0]) + Offset (rp, 0));
+        forbidden_attachments.push_back (Offset (b.control_[3]) + Offset (rp, 0));
+      }
+
+  return forbidden_attachments;
+}
+
 Extra_collision_info::Extra_collision_info (Grob *g, Real idx, Interval x, Interval y, Real p)
 {
   idx_ = idx;
@@ -860,6 +910,7 @@ Extra_collision_info::Extra_collision_info (Grob *g, Real idx, Interval x, Inter
   penalty_ = p;
   grob_ = g;
   type_ = g->get_property ("avoid-slur");
+  bound_dir_ = CENTER;
 }
 
 Extra_collision_info::Extra_collision_info ()
@@ -868,4 +919,5 @@ Extra_collision_info::Extra_collision_info ()
   penalty_ = 0.;
   grob_ = 0;
   type_ = SCM_EOL;
+  bound_dir_ = CENTER;
 }
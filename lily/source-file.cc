@@ -28,13 +28,24 @@
 #include "config.hh"
 
 #include <cstdio>
+#include <cstring>
 
-#if HAVE_SSTREAM
-#include <sstream>
-#else
-#include <strstream>
-#define istringstream(x) istrstream (x, length ())
+#include <list>
+#include <map>
+
+#if HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
 #endif
+
 using namespace std;
 
 #include "file-name-map.hh"
@@ -100,11 +111,214 @@ void
 Source_file::init ()
 {
   istream_ = 0;
+  streambuf_ = 0;
   line_offset_ = 0;
+  newlines_found_ = false;
+  data_ = 0;
+  length_ = 0;
+  contents_ = 0;
   str_port_ = SCM_EOL;
   smobify_self ();
 }
 
+/* Use CHARACTERS_ as the contents, after adding the terminating 0. */
+void
+Source_file::set_characters ()
+{
+  characters_.push_back (0);
+  data_ = &characters_[0];
+  length_ = characters_.size ();
+}
+
+/*
+  The contents of a file, 0-terminated, shared by all Source_files for
+  it.  Entries outlive their last Source_file, so that in a run over
+  many input files init.ly and shared include files are read only
+  once, and children forked by -djob-count or -dserve-files start with
+  them.  An entry is only handed out while the modification time and
+  size of the file are unchanged.
+*/
+struct File_contents
+{
+  string filename_;
+  time_t mtime_;
+  vsize size_;
+  vector<char> characters_;
+  char const *data_;
+  vsize length_;
+  void *mapping_;
+  vsize mapping_size_;
+  int refs_;
+  /* the position in unused_file_contents while refs_ is 0 */
+  list<File_contents *>::iterator unused_pos_;
+};
+
+/* The current entry for each file read so far. */
+static map<string, File_contents *> file_contents_cache;
+
+/* The entries that no Source_file uses, most recently used first, and
+   the sum of their lengths. */
+static list<File_contents *> unused_file_contents;
+static vsize unused_file_contents_length = 0;
+
+/*
+  Unused entries are dropped, least recently used first, beyond this
+  many bytes.  init.ly and everything it includes take a few megabytes.
+*/
+static const vsize MAX_UNUSED_LENGTH = 1 << 25;
+
+/*
+  Mapping a file costs a few system calls, which is more than copying
+  a small file.
+*/
+static const vsize MIN_MAPPED_SIZE = 1 << 16;
+
+/* Map FILENAME, with SIZE bytes, into CONTENTS.  */
+static bool
+map_file (const string &filename, vsize size, File_contents *contents)
+{
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+  if (size < MIN_MAPPED_SIZE)
+    return false;
+
+  int fd = open (filename.c_str (), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  /*
+    Reserve anonymous, zero-filled memory that extends past the end of
+    the file, then map the file over its start; the byte after the
+    contents is the terminating 0.
+  */
+  vsize page = sysconf (_SC_PAGESIZE);
+  vsize total = (size / page + 1) * page;
+  void *p = mmap (0, total, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p != MAP_FAILED
+      && mmap (p, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+      munmap (p, total);
+      p = MAP_FAILED;
+    }
+  close (fd);
+  if (p == MAP_FAILED)
+    return false;
+
+  contents->mapping_ = p;
+  contents->mapping_size_ = total;
+  contents->data_ = static_cast<char const *> (p);
+  contents->length_ = size + 1;
+  return true;
+#else
+  (void) filename;
+  (void) size;
+  (void) contents;
+  return false;
+#endif
+}
+
+static void
+free_file_contents (File_contents *contents)
+{
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+  if (contents->mapping_)
+    munmap (contents->mapping_, contents->mapping_size_);
+#endif
+  delete contents;
+}
+
+/*
+  Return the contents of FILENAME with one more reference, reading
+  the file if it is not cached or has changed.  Return 0 if it is not
+  a regular file.
+*/
+static File_contents *
+acquire_file_contents (const string &filename)
+{
+#if HAVE_SYS_STAT_H
+  struct stat st;
+  if (stat (filename.c_str (), &st) || !S_ISREG (st.st_mode))
+    return 0;
+
+  File_contents *&entry = file_contents_cache[filename];
+  if (entry && (entry->mtime_ != st.st_mtime
+                || entry->size_ != vsize (st.st_size)))
+    {
+      /* A replaced entry that is still used is freed by its last
+         user. */
+      if (!entry->refs_)
+        {
+          unused_file_contents.erase (entry->unused_pos_);
+          unused_file_contents_length -= entry->length_;
+          free_file_contents (entry);
+        }
+      entry = 0;
+    }
+
+  if (!entry)
+    {
+      entry = new File_contents;
+      entry->filename_ = filename;
+      entry->mtime_ = st.st_mtime;
+      entry->size_ = st.st_size;
+      entry->mapping_ = 0;
+      entry->mapping_size_ = 0;
+      entry->refs_ = 0;
+      if (!map_file (filename, entry->size_, entry))
+        {
+          entry->characters_ = gulp_file (filename, -1);
+          /* read the file again next time if it did not work */
+          if (entry->characters_.size () != entry->size_)
+            entry->mtime_ = 0;
+          entry->characters_.push_back (0);
+          entry->data_ = &entry->characters_[0];
+          entry->length_ = entry->characters_.size ();
+        }
+    }
+  else if (!entry->refs_)
+    {
+      unused_file_contents.erase (entry->unused_pos_);
+      unused_file_contents_length -= entry->length_;
+    }
+  entry->refs_++;
+  return entry;
+#else
+  (void) filename;
+  return 0;
+#endif
+}
+
+/*
+  Drop a reference to CONTENTS.  After the last one, they are kept for
+  later Source_files, unless they have been replaced.
+*/
+static void
+release_file_contents (File_contents *contents)
+{
+  if (--contents->refs_ > 0)
+    return;
+
+  map<string, File_contents *>::iterator i
+    = file_contents_cache.find (contents->filename_);
+  if (i == file_contents_cache.end () || i->second != contents)
+    {
+      free_file_contents (contents);
+      return;
+    }
+
+  unused_file_contents.push_front (contents);
+  contents->unused_pos_ = unused_file_contents.begin ();
+  unused_file_contents_length += contents->length_;
+
+  while (unused_file_contents_length > MAX_UNUSED_LENGTH)
+    {
+      File_contents *old = unused_file_contents.back ();
+      unused_file_contents.pop_back ();
+      unused_file_contents_length -= old->length_;
+      file_contents_cache.erase (old->filename_);
+      free_file_contents (old);
+    }
+}
+
 Source_file::Source_file (const string &filename, const string &data)
 {
   init ();
@@ -114,13 +328,7 @@ Source_file::Source_file (const string &filename, const string &data)
   characters_.resize (data.length ());
   copy (data.begin (), data.end (), characters_.begin ());
 
-  characters_.push_back (0);
-
-  init_port ();
-
-  for (vsize i = 0; i < characters_.size (); i++)
-    if (characters_[i] == '\n')
-      newline_locations_.push_back (&characters_[0] + i);
+  set_characters ();
 }
 
 Source_file::Source_file (const string &filename_string)
@@ -131,44 +339,66 @@ Source_file::Source_file (const string &filename_string)
 
   if (filename_string == "-")
     load_stdin ();
+  else if ((contents_ = acquire_file_contents (filename_string)))
+    {
+      data_ = contents_->data_;
+      length_ = contents_->length_;
+      return;
+    }
   else
     {
       characters_ = gulp_file (filename_string, -1);
     }
 
-  characters_.push_back (0);
-
-  init_port ();
-
-  for (vsize i = 0; i < characters_.size (); i++)
-    if (characters_[i] == '\n')
-      newline_locations_.push_back (&characters_[0] + i);
+  set_characters ();
 }
 
 void
-Source_file::init_port ()
+Source_file::find_newlines () const
+{
+  for (vsize i = 0; i < length_; i++)
+    if (data_[i] == '\n')
+      newline_locations_.push_back (data_ + i);
+  newlines_found_ = true;
+}
+
+SCM
+Source_file::get_port () const
 {
-  // This is somewhat icky: the string will in general be in utf8, but
-  // we do our own utf8 encoding and verification in the parser, so we
-  // use the no-conversion equivalent of latin1
-  SCM str = scm_from_latin1_string (c_str ());
-  str_port_ = scm_mkstrport (SCM_INUM0, str, SCM_OPN | SCM_RDNG, __FUNCTION__);
-  scm_set_port_filename_x (str_port_, ly_string2scm (name_));
+  if (scm_is_null (str_port_))
+    {
+      // This is somewhat icky: the string will in general be in utf8, but
+      // we do our own utf8 encoding and verification in the parser, so we
+      // use the no-conversion equivalent of latin1
+      SCM str = scm_from_latin1_string (c_str ());
+      str_port_ = scm_mkstrport (SCM_INUM0, str, SCM_OPN | SCM_RDNG, __FUNCTION__);
+      scm_set_port_filename_x (str_port_, ly_string2scm (name_));
+    }
+  return str_port_;
 }
 
+/* Reads the contents in place, where istringstream would copy them. */
+class Memory_streambuf : public streambuf
+{
+public:
+  Memory_streambuf (char const *data, vsize length)
+  {
+    char *p = const_cast<char *> (data);
+    setg (p, p, p + length);
+  }
+};
+
 istream *
 Source_file::get_istream ()
 {
   if (!istream_)
     {
-      if (length ()) // can-t this be done without such a hack?
-        istream_ = new istringstream (c_str ());
-      else
-        {
-          istream_ = new istringstream ("");
-          istream_->setstate (ios::eofbit);
-          //      istream_->set (ios::eofbit);
-        }
+      // like the string that istringstream used to get, stop at the
+      // first 0
+      streambuf_ = new Memory_streambuf (c_str (), strlen (c_str ()));
+      istream_ = new istream (streambuf_);
+      if (!length ())
+        istream_->setstate (ios::eofbit);
     }
   return istream_;
 }
@@ -213,6 +443,9 @@ Source_file::name_string () const
 Source_file::~Source_file ()
 {
   delete istream_;
+  delete streambuf_;
+  if (contents_)
+    release_file_contents (contents_);
 }
 
 Slice
@@ -315,6 +548,9 @@ Source_file::get_line (char const *pos_str0) const
   if (!contains (pos_str0))
     return 0;
 
+  if (!newlines_found_)
+    find_newlines ();
+
   if (!newline_locations_.size ())
     return 1 + line_offset_;
 
@@ -344,19 +580,13 @@ Source_file::set_line (char const *pos_str0, int line)
 int
 Source_file::length () const
 {
-  return characters_.size ();
+  return length_;
 }
 
 char const *
 Source_file::c_str () const
 {
-  return &characters_[0];
-}
-
-SCM
-Source_file::get_port () const
-{
-  return str_port_;
+  return data_;
 }
 
 /****************************************************************/
@@ -367,6 +367,8 @@ Tie_formatting_problem::from_ties (vector<Grob *> const &ties)
         }
       specifications_.push_back (spec);
     }
+
+  set_specification_head_info ();
 }
 
 void
@@ -425,6 +427,34 @@ Tie_formatting_problem::from_semi_ties (vector<Grob *> const &semi_ties, Directi
 
   chord_outlines_[open_key] = Skyline (head_dir);
   chord_outlines_[open_key].set_minimum_height (extremal - head_dir * 1.5);
+
+  set_specification_head_info ();
+}
+
+/*
+  Look up everything score_aptitude () needs from the note heads, so
+  that generating and scoring configurations does not read grobs.
+*/
+void
+Tie_formatting_problem::set_specification_head_info ()
+{
+  for (vsize i = 0; i < specifications_.size (); i++)
+    {
+      Tie_specification &spec = specifications_[i];
+      for (LEFT_and_RIGHT (d))
+        {
+          Grob *head = spec.note_head_drul_[d];
+          if (!head)
+            continue;
+
+          spec.note_head_x_extent_drul_[d] = head->extent (x_refpoint_, X_AXIS);
+
+          Grob *stem = unsmob<Grob> (head->get_object ("stem"));
+          if (stem
+              && Stem::is_normal_stem (stem))
+            spec.stem_dir_drul_[d] = get_grob_direction (stem);
+        }
+    }
 }
 
 Tie_specification
@@ -634,7 +664,7 @@ Tie_formatting_problem::score_aptitude (Tie_configuration *conf,
       if (!spec.note_head_drul_[d])
         continue;
 
-      Interval head_x = spec.note_head_drul_[d]->extent (x_refpoint_, X_AXIS);
+      Interval head_x = spec.note_head_x_extent_drul_[d];
       Real dist = head_x.distance (conf->attachment_x_[d]);
 
       /*
@@ -653,27 +683,17 @@ Tie_formatting_problem::score_aptitude (Tie_configuration *conf,
   if (ties_conf
       && ties_conf->size () == 1)
     {
-      Drul_array<Grob *> stems (0, 0);
-      for (LEFT_and_RIGHT (d))
-        {
-          if (!spec.note_head_drul_[d])
-            continue;
-
-          Grob *stem = unsmob<Grob> (spec.note_head_drul_[d]->get_object ("stem"));
-          if (stem
-              && Stem::is_normal_stem (stem))
-            stems[d] = stem;
-        }
+      Drul_array<Direction> stem_dirs = spec.stem_dir_drul_;
 
       bool tie_stem_dir_ok = true;
       bool tie_position_dir_ok = true;
-      if (stems[LEFT] && !stems[RIGHT])
-        tie_stem_dir_ok = conf->dir_ != get_grob_direction (stems[LEFT]);
-      else if (!stems[LEFT] && stems[RIGHT])
-        tie_stem_dir_ok = conf->dir_ != get_grob_direction (stems[RIGHT]);
-      else if (stems[LEFT] && stems[RIGHT]
-               && get_grob_direction (stems[LEFT]) == get_grob_direction (stems[RIGHT]))
-        tie_stem_dir_ok = conf->dir_ != get_grob_direction (stems[LEFT]);
+      if (stem_dirs[LEFT] && !stem_dirs[RIGHT])
+        tie_stem_dir_ok = conf->dir_ != stem_dirs[LEFT];
+      else if (!stem_dirs[LEFT] && stem_dirs[RIGHT])
+        tie_stem_dir_ok = conf->dir_ != stem_dirs[RIGHT];
+      else if (stem_dirs[LEFT] && stem_dirs[RIGHT]
+               && stem_dirs[LEFT] == stem_dirs[RIGHT])
+        tie_stem_dir_ok = conf->dir_ != stem_dirs[LEFT];
       else if (spec.position_)
         tie_position_dir_ok = conf->dir_ == sign (spec.position_);
 
@@ -18,6 +18,8 @@ Tie_specification::Tie_specification ()
   manual_dir_ = CENTER;
   note_head_drul_[LEFT]
     = note_head_drul_[RIGHT] = 0;
+  stem_dir_drul_[LEFT]
+    = stem_dir_drul_[RIGHT] = CENTER;
   column_ranks_[RIGHT]
     = column_ranks_[LEFT] = 0;
 }
@@ -1290,8 +1290,6 @@ for this column.")
      (make-dead-when ,ly:grob-array? "An array of other
 @code{VerticalAxisGroup}s.  If any of them are alive, then we will turn dead.")
      (melody-spanner ,ly:grob? "The @code{MelodyItem} object for a stem.")
-     (minimum-translations-alist ,list? "An list of translations for a given
-start and end point.")
 
      (neighbors ,ly:grob-array? "The X-axis neighbors of a grob. Used by the
 pure-from-neighbor-interface to determine various grob heights.")
@@ -1361,6 +1359,9 @@ used to create vertical skylines.")
      (adjacent-pure-heights ,pair? "A pair of vectors.  Used by a
 @code{VerticalAxisGroup} to cache the @code{Y-extent}s of different column
 ranges.")
+     (adjacent-pure-height-trees ,pair? "A pair of segment trees built
+from @code{adjacent-pure-heights}, for finding the combined height of
+a range of measures quickly.")
 
      (begin-of-line-visible ,boolean? "Set to make @code{ChordName} or
 @code{FretBoard} be visible only at beginning of line or at
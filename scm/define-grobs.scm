@@ -339,6 +339,7 @@
 
     (BassFigureLine
      . (
+        (adjacent-pure-height-trees . ,ly:axis-group-interface::calc-adjacent-pure-height-trees)
         (adjacent-pure-heights . ,ly:axis-group-interface::adjacent-pure-heights)
         (axes . (,Y))
         (vertical-skylines . ,ly:axis-group-interface::calc-skylines)
@@ -2263,6 +2264,7 @@
 
     (System
      . (
+        (adjacent-pure-height-trees . ,ly:axis-group-interface::calc-adjacent-pure-height-trees)
         (adjacent-pure-heights . ,ly:axis-group-interface::adjacent-pure-heights)
         (axes . (,X ,Y))
         (outside-staff-placement-directive . left-to-right-polite)
@@ -2703,6 +2705,7 @@
 
     (VerticalAxisGroup
      . (
+        (adjacent-pure-height-trees . ,ly:axis-group-interface::calc-adjacent-pure-height-trees)
         (adjacent-pure-heights . ,ly:axis-group-interface::adjacent-pure-heights)
         (axes . (,Y))
         (default-staff-staff-spacing . ((basic-distance . 9)
@@ -29,6 +29,9 @@
 
 (use-modules (scm accreg))
 
+;; Files that are otherwise loaded on first use still get documented.
+(load-lazy-scheme-files)
+
 (for-each ly:load '("documentation-lib.scm"
                     "lily-sort.scm"
                     "document-functions.scm"
@@ -16,13 +16,19 @@
 ;;;; along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
 
 
+;; Maps a file name to (STAMP . CONTENTS), where STAMP holds the
+;; modification time and size.  A file that changes during a long run
+;; is read again and replaces its old entry.
 (define cache-hash-tab  (make-hash-table 11))
 (define-public (cached-file-contents filename)
   (let*
-      ((contents (hash-ref cache-hash-tab filename #f)))
+      ((st (false-if-exception (stat filename)))
+       (stamp (and st (list (stat:mtime st) (stat:size st))))
+       (entry (hash-ref cache-hash-tab filename #f))
+       (contents (and entry (equal? (car entry) stamp) (cdr entry))))
 
     (if (not (string? contents))
         (begin
           (set! contents (ly:gulp-file filename))
-          (hash-set! cache-hash-tab filename contents)))
+          (hash-set! cache-hash-tab filename (cons stamp contents))))
     contents))
@@ -248,6 +248,15 @@ bookoutput function"
 (define-public (print-book-with-defaults-as-systems book)
   (print-book-with book ly:book-process-to-systems))
 
+(define-public (print-score-with-defaults score)
+  "Toplevel score handler for @code{-dstream-scores}: process
+@var{score} as a book of its own right away, instead of collecting it
+for the book made at the end of the input."
+  (print-book-with-defaults
+   (ly:make-book (ly:parser-lookup '$defaultpaper)
+                 (ly:parser-lookup '$defaultheader)
+                 score)))
+
 ;; Add a score to the current bookpart, book or toplevel
 (define-public (add-score score)
   (cond
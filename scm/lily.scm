@@ -225,6 +225,15 @@ EPS backend.")
     (check-internal-types
      #f
      "Check every property assignment for types.")
+    (check-line-breaking
+     #f
+     "Warn when the linear line breaker (selected with
+`breaking-algorithm = #'linear') chooses different line
+breaks than the default one.")
+    (check-midi-job-count
+     #f
+     "Warn when a MIDI track written with
+`midi-job-count' differs from the track written without it.")
     (clip-systems
      #f
      "Generate cut-out snippets of a score.")
@@ -316,6 +325,21 @@ null markup instead.")
                          "midi")
                     "Set the default file extension for MIDI output
 file to given string.")
+    (midi-job-count
+     #f
+     "Write the tracks of each MIDI file in parallel,
+using the given number of processes.")
+    (midi-only
+     #f
+     "Only produce MIDI output: interpret every score
+with its \\midi blocks alone, skipping \\layout
+blocks, top-level markups, titles and all other
+typesetting.")
+    (midi-stream
+     #f
+     "While interpreting, send the MIDI events of
+every score to the given file, named pipe or Unix
+domain socket as soon as they are produced.")
     (music-strings-to-paths
      #f
      "Convert text strings to paths when glyphs belong
@@ -364,9 +388,20 @@ the included file relative to the current file\
      "For input files `FILE1.ly', `FILE2.ly', ...
 output log data to files `FILE1.log',
 `FILE2.log', ...")
+    (serve-files
+     #f
+     "Initialize once, then read names of input files
+from standard input, one per line, and process
+each in a forked copy of the initialized process.")
     (show-available-fonts
      #f
      "List available font names.")
+    (stream-scores
+     #f
+     "Process every toplevel \\score as soon as it
+is parsed, into an output file of its own, so
+that its music can be freed before the rest of
+the input is read.")
     (strict-infinity-checking
      #f
      "Force a crash on encountering Inf and NaN
@@ -598,7 +633,6 @@ messages into errors.")
     "chord-generic-names.scm"
     "chord-ignatzek-names.scm"
     "music-functions.scm"
-    "part-combiner.scm"
     "autochange.scm"
     "define-music-properties.scm"
     "time-signature.scm"
@@ -622,8 +656,6 @@ messages into errors.")
     "fret-diagrams.scm"
     "tablature.scm"
     "harp-pedals.scm"
-    "define-woodwind-diagrams.scm"
-    "display-woodwind-diagrams.scm"
     "predefined-fretboards.scm"
     "define-grob-properties.scm"
     "define-grobs.scm"
@@ -636,6 +668,13 @@ messages into errors.")
     "paper.scm"
     "backend-library.scm"
     "x11-color.scm"))
+;;  - Files loaded on first use of one of their public definitions,
+;;    in groups that are loaded together; keep in sync with
+;;    LAZY_SCM_FILES in scm/GNUmakefile
+(define init-scheme-files-lazy
+  '(("part-combiner.scm")
+    ("define-woodwind-diagrams.scm"
+     "display-woodwind-diagrams.scm")))
 ;;  - Files to be loaded last
 (define init-scheme-files-tail
   ;;  - must be after everything has been defined
@@ -651,6 +690,67 @@ messages into errors.")
 
 (for-each ly:load init-scheme-files)
 
+;; Lazy loading works through module binders, which Guile calls when a
+;; symbol is not found in a module.  The symbols each lazy file exports
+;; are listed in out/lazy-symbols.scm, generated at build time; the
+;; binder of the (lily) module and its public interface loads the
+;; group defining the symbol and returns the new variable.
+
+(define lily-module (current-module))
+
+;; symbol -> group in `init-scheme-files-lazy'
+(define lazy-scheme-symbols (make-hash-table 101))
+(define lazy-scheme-groups-loaded (make-hash-table 11))
+
+(define (load-lazy-scheme-group group)
+  (if (not (hashq-ref lazy-scheme-groups-loaded group))
+      (begin
+        (hashq-set! lazy-scheme-groups-loaded group #t)
+        (save-module-excursion
+         (lambda ()
+           (set-current-module lily-module)
+           (for-each ly:load group))))))
+
+(define-public (load-lazy-scheme-files)
+  "Load all Scheme files that are otherwise only loaded on first use,
+for example to document their definitions."
+  (for-each load-lazy-scheme-group init-scheme-files-lazy))
+
+(define (lazy-scheme-binder module sym define?)
+  (let ((group (and (not define?)
+                    (hashq-ref lazy-scheme-symbols sym))))
+    (and group
+         (not (hashq-ref lazy-scheme-groups-loaded group))
+         (begin
+           (ly:debug "Loading ~a for `~a'" group sym)
+           (load-lazy-scheme-group group)
+           (module-local-variable module sym)))))
+
+(let ((table (%search-load-path "out/lazy-symbols.scm")))
+  (if table
+      (begin
+        (for-each
+         (lambda (entry)
+           (let ((group (find (lambda (g) (member (car entry) g))
+                              init-scheme-files-lazy)))
+             (if group
+                 (for-each (lambda (sym)
+                             (hashq-set! lazy-scheme-symbols sym group))
+                           (cdr entry)))))
+         (with-input-from-file table read))
+        ;; Groups that the table knows nothing about can never be
+        ;; found by the binder; load those right away.
+        (let ((known (hash-fold (lambda (sym group acc) (cons group acc))
+                                '() lazy-scheme-symbols)))
+          (for-each (lambda (group)
+                      (if (not (memq group known))
+                          (load-lazy-scheme-group group)))
+                    init-scheme-files-lazy))
+        (set-module-binder! lily-module lazy-scheme-binder)
+        (set-module-binder! (module-public-interface lily-module)
+                            lazy-scheme-binder))
+      (load-lazy-scheme-files)))
+
 (define-public r5rs-primary-predicates
   `((,boolean? . "boolean")
     (,char? . "character")
@@ -949,6 +1049,8 @@ PIDs or the number of the process."
              (ly:exit 0 #t)))
   (if (ly:get-option 'gui)
       (gui-main files))
+  (if (ly:get-option 'serve-files)
+      (serve-files))
   (if (null? files)
       (begin (ly:usage)
              (ly:exit 2 #t)))
@@ -963,7 +1065,8 @@ PIDs or the number of the process."
            (>= (length files) (ly:get-option 'job-count)))
       (let* ((count (ly:get-option 'job-count))
              (split-todo (split-list files count))
-             (joblist (multi-fork count))
+             (joblist (begin (load-init-files)
+                             (multi-fork count)))
              (errors '()))
         (if (not (string-or-symbol? (ly:get-option 'log-file)))
             (ly:set-option 'log-file "lilypond-multi-run"))
@@ -1084,6 +1187,41 @@ PIDs or the number of the process."
         (dump-profile "lily-run-total" '(0 0) (profile-measurements)))
     failed))
 
+(define (load-init-files)
+  "Process an empty file, so that forked children start with the init
+files loaded and their contents cached."
+  ;; `session-initialize' records the declarations of this first run;
+  ;; children then start from that state instead of reading the init
+  ;; files again.
+  (let* ((port (mkstemp! (string-append (or (getenv "TMPDIR") "/tmp")
+                                        "/lilypond-init-XXXXXX")))
+         (name (port-filename port)))
+    (format port "\\version ~s\n" (lilypond-version))
+    (close-port port)
+    (lilypond-all (list name))
+    (delete-file name)))
+
+(define (serve-files)
+  "Process the input files named on standard input, one per line, each
+in a child forked from this process after initialization.  Print the
+name and exit status of every file to standard output."
+  (load-init-files)
+  (let loop ((line (read-line)))
+    (if (not (eof-object? line))
+        (let ((file (string-trim-both line)))
+          (if (not (string-null? file))
+              (let ((pid (primitive-fork)))
+                (if (= pid 0)
+                    (primitive-exit
+                     (if (pair? (lilypond-all (list file))) 1 0))
+                    (let ((status (cdr (waitpid pid))))
+                      (format #t "~a ~a\n" file
+                              (or (status:exit-val status)
+                                  (+ 128 (status:term-sig status))))
+                      (force-output)))))
+          (loop (read-line)))))
+  (ly:exit 0 #t))
+
 (define (lilypond-file handler file-name)
   (catch 'ly-file-failed
          (lambda () (ly:parse-file file-name))
@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+# This file is part of LilyPond, the GNU music typesetter.
+#
+# Copyright (C) 2016 agent <agent@local>
+#
+# LilyPond is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# LilyPond is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+
+# Listen on a Unix domain socket for the events that LilyPond sends
+# with -dmidi-stream, and print them as they arrive, with the time
+# since the connection was made.  For example
+#
+#   midi-stream-listen.py /tmp/lily-midi &
+#   lilypond -dmidi-stream=/tmp/lily-midi file.ly
+
+import os
+import socket
+import sys
+import time
+
+def varint (data, pos):
+    """Decode the variable length quantity at POS.  Return (value,
+    new pos), or None if DATA ends before it."""
+    value = 0
+    while pos < len (data):
+        byte = ord (data[pos:pos + 1])
+        pos += 1
+        value = (value << 7) | (byte & 0x7f)
+        if not byte & 0x80:
+            return (value, pos)
+    return None
+
+def event_length (data, pos):
+    """Return the length of the event at POS, or None if DATA ends
+    before it."""
+    if pos >= len (data):
+        return None
+    status = ord (data[pos:pos + 1])
+    if status == 0xff:
+        if pos + 2 > len (data):
+            return None
+        v = varint (data, pos + 2)
+        if not v:
+            return None
+        return v[1] + v[0] - pos
+    if status >> 4 in (0xc, 0xd):
+        return 2
+    return 3
+
+def describe (event):
+    status = ord (event[0:1])
+    data = [ord (event[i:i + 1]) for i in range (1, len (event))]
+    if status == 0xff:
+        return 'meta %02x %r' % (data[0], event[3:])
+    kind = status >> 4
+    channel = status & 0xf
+    if kind == 0x9 and data[1]:
+        return 'channel %2d note on  %3d velocity %d' % (channel, data[0], data[1])
+    if kind in (0x8, 0x9):
+        return 'channel %2d note off %3d' % (channel, data[0])
+    return 'channel %2d %s' % (channel, ' '.join ('%02x' % b for b in [status] + data))
+
+def listen (connection):
+    start = time.time ()
+    ticks = 0
+    data = b''
+    while True:
+        chunk = connection.recv (4096)
+        if not chunk:
+            break
+        data += chunk
+        pos = 0
+        while True:
+            v = varint (data, pos)
+            if not v:
+                break
+            length = event_length (data, v[1])
+            if length is None or v[1] + length > len (data):
+                break
+            ticks += v[0]
+            event = data[v[1]:v[1] + length]
+            sys.stdout.write ('%8.3fs %8d  %s\n'
+                              % (time.time () - start, ticks, describe (event)))
+            pos = v[1] + length
+        data = data[pos:]
+        sys.stdout.flush ()
+
+def main ():
+    if len (sys.argv) != 2:
+        sys.stderr.write ('usage: midi-stream-listen.py SOCKET\n')
+        sys.exit (2)
+    path = sys.argv[1]
+    if os.path.exists (path):
+        os.unlink (path)
+    server = socket.socket (socket.AF_UNIX, socket.SOCK_STREAM)
+    server.bind (path)
+    server.listen (1)
+    try:
+        while True:
+            (connection, address) = server.accept ()
+            listen (connection)
+            connection.close ()
+    finally:
+        os.unlink (path)
+
+if __name__ == '__main__':
+    main ()
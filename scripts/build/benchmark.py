@@ -0,0 +1,252 @@
+#!@PYTHON@
+
+# Time LilyPond on a tagged set of input files, record the results in a
+# JSON history and compare them against a stored baseline.
+#
+# The suite file has one `TAG FILE' pair per line; blank lines and
+# lines starting with `#' are ignored.  input/regression and
+# input/benchmarks are on LilyPond's include path.  Every file is run --runs times.
+# For each file we keep the wall-clock time of every run, the time
+# spent in each phase (recognized from LilyPond's progress messages)
+# and the peak resident memory.
+
+import sys
+import optparse
+import os
+import re
+import time
+import json
+import subprocess
+
+options = None
+
+# Progress messages that start a phase, in the order LilyPond prints
+# them.  A phase lasts until the next one starts or LilyPond exits.
+phase_markers = [
+    ('parsing', re.compile (r'Parsing\.\.\.')),
+    ('interpreting', re.compile (r'Interpreting music\.\.\.')),
+    ('preprocessing', re.compile (r'Preprocessing graphical objects\.\.\.')),
+    ('breaking', re.compile (r'Finding the ideal number of pages\.\.\.'
+                             r'|Fitting music on'
+                             r'|Calculating line breaks\.\.\.'
+                             r'|Calculating page'
+                             r'|Calculating page and line breaks')),
+    ('drawing', re.compile (r'Drawing systems\.\.\.')),
+    ('output', re.compile (r'Layout output to|Converting to')),
+    ]
+
+def read_suite (file_name, tags):
+    suite = []
+    for line in open (file_name).readlines ():
+        line = line.strip ()
+        if not line or line.startswith ('#'):
+            continue
+        (tag, ly) = line.split ()
+        if tags and tag not in tags:
+            continue
+        suite.append ((tag, ly))
+    return suite
+
+def run_once (ly):
+    """Run LilyPond on LY.  Return (seconds, phase seconds, peak KB)."""
+
+    # Suite files may include regression tests and the benchmark
+    # helpers by name, wherever the suite is run from.
+    include_dirs = ['-I', os.path.join (options.top_src_dir, 'input', 'regression'),
+                    '-I', os.path.join (options.top_src_dir, 'input', 'benchmarks')]
+    cmd = ([options.lilypond] + options.lilypond_options.split () + include_dirs + [
+        '-o', os.path.join (options.work_dir, os.path.splitext (os.path.basename (ly))[0]),
+        ly])
+
+    start = time.time ()
+    proc = subprocess.Popen (cmd, stdout=open (os.devnull, 'w'),
+                             stderr=subprocess.PIPE)
+    phases = {}
+    current = None
+    current_start = start
+    log = ''
+    while True:
+        chunk = os.read (proc.stderr.fileno (), 4096)
+        if not chunk:
+            break
+        now = time.time ()
+        chunk = chunk.decode ('utf-8', 'replace')
+        # Keep a little of the previous output, so that a message split
+        # across two reads is still recognized.
+        tail = log[-64:]
+        log += chunk
+        found = []
+        for (name, regex) in phase_markers:
+            for m in regex.finditer (tail + chunk):
+                if m.end () > len (tail):
+                    found.append ((m.start (), name))
+        for (pos, name) in sorted (found):
+            if current:
+                phases[current] = phases.get (current, 0.0) + now - current_start
+            current = name
+            current_start = now
+
+    (pid, status, usage) = os.wait4 (proc.pid, 0)
+    end = time.time ()
+    if current:
+        phases[current] = phases.get (current, 0.0) + end - current_start
+
+    if status:
+        sys.stderr.write (log)
+        raise Exception ('%s failed' % ' '.join (cmd))
+
+    return (end - start, phases, usage.ru_maxrss)
+
+def median (values):
+    values = sorted (values)
+    n = len (values)
+    if n % 2:
+        return values[n // 2]
+    return 0.5 * (values[n // 2 - 1] + values[n // 2])
+
+def run_suite (suite):
+    results = {}
+    for (tag, ly) in suite:
+        sys.stdout.write ('%-12s %s ' % (tag, ly))
+        sys.stdout.flush ()
+
+        times = []
+        phase_runs = {}
+        peak = 0
+        for i in range (options.runs):
+            (seconds, phases, rss) = run_once (os.path.join (options.top_src_dir, ly))
+            times.append (seconds)
+            for (name, t) in phases.items ():
+                phase_runs.setdefault (name, []).append (t)
+            peak = max (peak, rss)
+            sys.stdout.write ('.')
+            sys.stdout.flush ()
+
+        results[ly] = {
+            'tag': tag,
+            'times': times,
+            'median': median (times),
+            'phases': dict ((name, median (ts)) for (name, ts) in phase_runs.items ()),
+            'peak_kb': peak,
+            }
+        sys.stdout.write (' %.2fs, %d KB\n' % (results[ly]['median'], peak))
+    return results
+
+def spread (result):
+    return max (result['times']) - min (result['times'])
+
+def compare (results, baseline):
+    """Print how RESULTS differ from BASELINE.  Return the number of
+    regressions.
+
+    A change only counts if it exceeds all of: the relative threshold,
+    the absolute threshold, and --noise times the larger of the two
+    spreads between the fastest and slowest run."""
+
+    regressions = 0
+    for (ly, cur) in sorted (results.items ()):
+        if ly not in baseline:
+            print ('%-50s new' % ly)
+            continue
+        base = baseline[ly]
+        delta = cur['median'] - base['median']
+        threshold = max (options.threshold * base['median'],
+                         options.min_seconds,
+                         options.noise * max (spread (cur), spread (base)))
+        verdict = 'ok'
+        if delta > threshold:
+            verdict = 'REGRESSION'
+            regressions += 1
+        elif -delta > threshold:
+            verdict = 'improvement'
+        print ('%-50s %7.2fs -> %7.2fs (%+6.1f%%)  %s'
+               % (ly, base['median'], cur['median'],
+                  100.0 * delta / max (base['median'], 1e-6), verdict))
+
+        if verdict != 'ok':
+            for (name, t) in sorted (cur['phases'].items ()):
+                old = base['phases'].get (name)
+                if old is not None:
+                    print ('    %-16s %7.2fs -> %7.2fs' % (name, old, t))
+
+        memory_threshold = options.threshold * base['peak_kb']
+        if cur['peak_kb'] - base['peak_kb'] > memory_threshold:
+            print ('    peak memory %d KB -> %d KB' % (base['peak_kb'], cur['peak_kb']))
+    return regressions
+
+def git_revision ():
+    try:
+        proc = subprocess.Popen (['git', 'describe', '--always', '--dirty'],
+                                 cwd=options.top_src_dir,
+                                 stdout=subprocess.PIPE,
+                                 stderr=open (os.devnull, 'w'))
+        return proc.communicate ()[0].decode ('utf-8').strip ()
+    except OSError:
+        return ''
+
+def main ():
+    p = optparse.OptionParser ("benchmark - time LilyPond on a suite of files\n"
+                               + "usage: benchmark [options] SUITE")
+
+    p.add_option ('--lilypond', dest='lilypond', default='lilypond',
+                  help='the LilyPond binary to time')
+    p.add_option ('--lilypond-options', dest='lilypond_options',
+                  default='-dbackend=null',
+                  help='options passed to every LilyPond run [%default]')
+    p.add_option ('--top-src-dir', dest='top_src_dir', default='.',
+                  help='directory that the suite paths are relative to')
+    p.add_option ('--work-dir', dest='work_dir', default='out/bench',
+                  help='where to put the output and the JSON files')
+    p.add_option ('--tags', dest='tags', default='',
+                  help='comma-separated tags to run; all if empty')
+    p.add_option ('--runs', dest='runs', default=3, type='int',
+                  help='runs per file; the median is compared [%default]')
+    p.add_option ('--threshold', dest='threshold', default=0.05, type='float',
+                  help='relative change that counts as a regression [%default]')
+    p.add_option ('--min-seconds', dest='min_seconds', default=0.05, type='float',
+                  help='smallest absolute change that counts [%default]')
+    p.add_option ('--noise', dest='noise', default=2.0, type='float',
+                  help='multiple of the run-to-run spread that counts [%default]')
+    p.add_option ('--save-baseline', dest='save_baseline', default=False,
+                  action='store_true',
+                  help='store this run as the baseline instead of comparing')
+
+    global options
+    (options, args) = p.parse_args ()
+    if len (args) != 1:
+        p.print_usage ()
+        sys.exit (2)
+
+    if not os.path.isdir (options.work_dir):
+        os.makedirs (options.work_dir)
+    history_file = os.path.join (options.work_dir, 'history.json')
+    baseline_file = os.path.join (options.work_dir, 'baseline.json')
+
+    tags = [t for t in options.tags.split (',') if t]
+    results = run_suite (read_suite (args[0], tags))
+
+    history = []
+    if os.path.exists (history_file):
+        history = json.load (open (history_file))
+    history.append ({
+        'date': time.strftime ('%Y-%m-%d %H:%M:%S'),
+        'revision': git_revision (),
+        'lilypond-options': options.lilypond_options,
+        'results': results,
+        })
+    json.dump (history, open (history_file, 'w'), indent=1, sort_keys=True)
+
+    if options.save_baseline:
+        json.dump (results, open (baseline_file, 'w'), indent=1, sort_keys=True)
+        print ('baseline written to %s' % baseline_file)
+        return
+
+    if not os.path.exists (baseline_file):
+        print ('no baseline in %s; run make bench-baseline first' % baseline_file)
+        return
+
+    if compare (results, json.load (open (baseline_file))):
+        sys.exit (1)
+
+if __name__ == '__main__':
+    main ()
@@ -0,0 +1,46 @@
+#!@PYTHON@
+
+# Generate the table of lazily loaded Scheme files read by scm/lily.scm.
+# For every file given on the command line, list the symbols that the
+# file exports, so that LilyPond can load the file the first time one
+# of them is looked up.
+
+import re
+import sys
+import os
+
+# Top-level definitions that export a symbol.
+definition = re.compile (r'^\((?:define\*?-public|define-safe-public'
+                         r'|defmacro\*?-public)\s+\(?([^\s()]+)', re.M)
+
+# Markup commands export COMMAND-markup and make-COMMAND-markup,
+# markup list commands the same with `-markup-list'.
+markup_command = re.compile (r'^\(define-markup(-list)?-command\s+\(([^\s()]+)',
+                             re.M)
+
+def exported_symbols (file_name):
+    s = open (file_name).read ()
+    symbols = definition.findall (s)
+    for (is_list, command) in markup_command.findall (s):
+        suffix = '-markup'
+        if is_list:
+            suffix = '-markup-list'
+        symbols += [command + suffix, 'make-' + command + suffix]
+    return symbols
+
+def main ():
+    if len (sys.argv) < 2:
+        sys.stderr.write ('usage: scm-autoload FILE.scm...\n')
+        sys.exit (2)
+
+    sys.stdout.write (';;;; Generated by scm-autoload from scm/GNUmakefile.\n'
+                      ';;;; Do not edit.\n\n(')
+    for file_name in sys.argv[1:]:
+        sys.stdout.write ('\n ("%s"' % os.path.basename (file_name))
+        for symbol in exported_symbols (file_name):
+            sys.stdout.write ('\n  %s' % symbol)
+        sys.stdout.write (')')
+    sys.stdout.write (')\n')
+
+if __name__ == '__main__':
+    main ()